@@ -1,6 +1,7 @@
 console = {}
 console.log = function(a){
-    print(a);
+    // mksnapshot runs this without the native print
+    if (typeof print == "function") print(a);
 }
 
 var avroparse = new AvroForGaia();
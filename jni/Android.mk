@@ -5,7 +5,19 @@ include $(CLEAR_VARS)
 LOCAL_MODULE    := avrov8
 LOCAL_C_INCLUDES := $(LOCAL_PATH)/external/v8/include
 
-LOCAL_SRC_FILES := avrov8.cpp
+LOCAL_SRC_FILES := avrov8.cpp \
+    avro/dictionary.cpp \
+    avro/edit_distance.cpp \
+    avro/phonetic.cpp \
+    avro/phonetic_data.cpp \
+    avro/phonetic_regex.cpp \
+    avro/search_session.cpp \
+    avro/selection_store.cpp \
+    avro/suffix_trie.cpp \
+    avro/suggestion_builder.cpp \
+    avro/suggestion_data.cpp \
+    avro/suggestion_worker.cpp \
+    avro/trace.cpp
 LOCAL_STATIC_LIBRARIES := v8
 LOCAL_LDLIBS := -llog
 
@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <cstring>
+
+#include "batch_parser.h"
+
+namespace avro {
+
+BatchParser::BatchParser(const PhoneticParser *parser, const int threadCount)
+        : mParser(parser), mThreadCount(threadCount < 1 ? 1 : threadCount), mChunks(),
+          mMutex(), mNextChunk(0) {
+    pthread_mutex_init(&mMutex, NULL);
+}
+
+BatchParser::~BatchParser() {
+    pthread_mutex_destroy(&mMutex);
+}
+
+void BatchParser::parse(const char *text, const size_t length, std::string *output) {
+    const char *const end = text + length;
+    mChunks.clear();
+    for (const char *begin = text; begin < end;) {
+        const char *chunkEnd = end;
+        if (static_cast<size_t>(end - begin) > CHUNK_SIZE) {
+            // Up to the first line end past the chunk size, so no line is split.
+            const char *newline = static_cast<const char *>(
+                    memchr(begin + CHUNK_SIZE, '\n', end - begin - CHUNK_SIZE));
+            chunkEnd = newline ? newline + 1 : end;
+        }
+        mChunks.push_back(Chunk());
+        mChunks.back().begin = begin;
+        mChunks.back().end = chunkEnd;
+        begin = chunkEnd;
+    }
+    mNextChunk = 0;
+    const int workerCount = std::min(mThreadCount, static_cast<int>(mChunks.size())) - 1;
+    std::vector<pthread_t> workers;
+    for (int i = 0; i < workerCount; ++i) {
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, runWorker, this) != 0) {
+            AVRO_LOGE("Can't start a parser thread");
+            break;
+        }
+        workers.push_back(thread);
+    }
+    parseChunks();
+    for (size_t i = 0; i < workers.size(); ++i) {
+        pthread_join(workers[i], NULL);
+    }
+    size_t outputLength = output->size();
+    for (size_t i = 0; i < mChunks.size(); ++i) {
+        outputLength += mChunks[i].output.size();
+    }
+    output->reserve(outputLength);
+    for (size_t i = 0; i < mChunks.size(); ++i) {
+        output->append(mChunks[i].output);
+    }
+    mChunks.clear();
+}
+
+void *BatchParser::runWorker(void *batchParser) {
+    static_cast<BatchParser *>(batchParser)->parseChunks();
+    return NULL;
+}
+
+void BatchParser::parseChunks() {
+    std::string line;
+    for (;;) {
+        pthread_mutex_lock(&mMutex);
+        const size_t index = mNextChunk;
+        if (index < mChunks.size()) {
+            ++mNextChunk;
+        }
+        pthread_mutex_unlock(&mMutex);
+        if (index >= mChunks.size()) {
+            return;
+        }
+        parseChunk(&mChunks[index], &line);
+    }
+}
+
+void BatchParser::parseChunk(Chunk *chunk, std::string *line) const {
+    std::string parsed;
+    // Bengali takes about three bytes for every roman letter.
+    chunk->output.reserve((chunk->end - chunk->begin) * 3);
+    for (const char *begin = chunk->begin; begin < chunk->end;) {
+        const char *newline = static_cast<const char *>(
+                memchr(begin, '\n', chunk->end - begin));
+        const char *lineEnd = newline ? newline : chunk->end;
+        line->assign(begin, lineEnd);
+        mParser->parse(*line, &parsed);
+        chunk->output.append(parsed);
+        if (!newline) {
+            break;
+        }
+        chunk->output.push_back('\n');
+        begin = newline + 1;
+    }
+}
+
+} // namespace avro
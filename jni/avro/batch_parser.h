@@ -0,0 +1,54 @@
+#ifndef AVRO_BATCH_PARSER_H
+#define AVRO_BATCH_PARSER_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+#include "defines.h"
+#include "phonetic.h"
+
+namespace avro {
+
+// Transliterates whole texts rather than keystrokes, for converting archives and corpora off
+// the phone. The text is cut into chunks at line ends, which are parsed on |threadCount|
+// threads and joined back in order. Each line is parsed on its own, as if typed in one go.
+class BatchParser {
+ public:
+    BatchParser(const PhoneticParser *parser, const int threadCount);
+    ~BatchParser();
+
+    // Appends the transliteration of |length| bytes of UTF-8 |text| to |output|. A last line
+    // without a line end is parsed as it is, so callers feeding a stream should only pass
+    // complete lines.
+    void parse(const char *text, const size_t length, std::string *output);
+
+ private:
+    DISALLOW_IMPLICIT_CONSTRUCTORS(BatchParser);
+
+    static const size_t CHUNK_SIZE = 64 * 1024;
+
+    struct Chunk {
+        Chunk() : begin(NULL), end(NULL), output() {}
+
+        const char *begin;
+        const char *end;
+        std::string output;
+    };
+
+    static void *runWorker(void *batchParser);
+
+    void parseChunks();
+    void parseChunk(Chunk *chunk, std::string *line) const;
+
+    const PhoneticParser *const mParser;
+    const int mThreadCount;
+    std::vector<Chunk> mChunks;
+    // Guards |mNextChunk|, which the threads take their chunks by.
+    pthread_mutex_t mMutex;
+    size_t mNextChunk;
+};
+
+} // namespace avro
+#endif // AVRO_BATCH_PARSER_H
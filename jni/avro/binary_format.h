@@ -0,0 +1,153 @@
+#ifndef AVRO_BINARY_FORMAT_H
+#define AVRO_BINARY_FORMAT_H
+
+#include <stdint.h>
+
+#include "defines.h"
+
+namespace avro {
+
+// Reader for the binary Avro dictionary written by tools/avrodictc.cpp. The layout follows
+// LatinIME's version 2 format, trimmed down to what dbsearch needs: no probabilities, bigrams
+// or shortcuts, but every terminal records its index in the original js table so that results
+// can be reported in the same order the js does. All values are big endian.
+//
+// Header:
+//   Magic number (4 bytes) 0x41 0x56 0x44 0x43, version (2 bytes), table count (2 bytes)
+//   Table count times:
+//     Name (ascii, CHARACTER_ARRAY_TERMINATOR terminated)
+//     Word count (3 bytes), table offset from the start of the file (4 bytes), size (4 bytes)
+//
+// Every table is a trie of char groups starting with the root group:
+//   Group count (1 byte, or 2 if the first byte has 0x80 set)
+//   Group count times:
+//     Flags (1 byte)
+//     Code point, or code points terminated by CHARACTER_ARRAY_TERMINATOR if
+//       FLAG_HAS_MULTIPLE_CHARS is set. Bengali and printable ascii take a byte, anything else
+//       three.
+//     Word index (1 to 3 bytes as MASK_WORD_INDEX_SIZE says) if FLAG_IS_TERMINAL is set
+//     Children position (1 to 3 bytes as MASK_GROUP_ADDRESS_TYPE says), relative to where the
+//       position itself is stored.
+class BinaryFormat {
+ public:
+    static const int MAGIC_NUMBER = 0x41564443;
+    static const int FORMAT_VERSION = 1;
+    // Magic number (4 bytes), version (2 bytes), table count (2 bytes)
+    static const int HEADER_SIZE = 8;
+    // Word count (3 bytes), table offset (4 bytes), table size (4 bytes)
+    static const int TABLE_ENTRY_SIZE = 11;
+
+    static const int MASK_GROUP_ADDRESS_TYPE = 0xC0;
+    static const int FLAG_GROUP_ADDRESS_TYPE_NOADDRESS = 0x00;
+    static const int FLAG_GROUP_ADDRESS_TYPE_ONEBYTE = 0x40;
+    static const int FLAG_GROUP_ADDRESS_TYPE_TWOBYTES = 0x80;
+    static const int FLAG_GROUP_ADDRESS_TYPE_THREEBYTES = 0xC0;
+    static const int FLAG_HAS_MULTIPLE_CHARS = 0x20;
+    static const int FLAG_IS_TERMINAL = 0x10;
+    // Size in bytes of the word index of a terminal.
+    static const int MASK_WORD_INDEX_SIZE = 0x03;
+
+    static const int NOT_A_CODE_POINT = -1;
+    static const int CHARACTER_ARRAY_TERMINATOR = 0x1F;
+    static const int MINIMAL_ONE_BYTE_CHARACTER_VALUE = 0x20;
+    static const int MAXIMAL_ASCII_CHARACTER_VALUE = 0x7E;
+    // Bytes 0x80 to 0xFF stand for the Bengali block U+0980 to U+09FF.
+    static const int BENGALI_BYTE_BASE = 0x80;
+    static const int BENGALI_BLOCK_START = 0x0980;
+    static const int BENGALI_BLOCK_END = 0x09FF;
+
+    static bool isValid(const uint8_t *const dict, const int dictSize);
+    static int getTableCount(const uint8_t *const dict);
+
+    static int readInt(const uint8_t *const dict, const int pos, const int size);
+    static int getGroupCountAndForwardPointer(const uint8_t *const dict, int *pos);
+    static uint8_t getFlagsAndForwardPointer(const uint8_t *const dict, int *pos);
+    static int getCodePointAndForwardPointer(const uint8_t *const dict, int *pos);
+    static int skipOtherCharacters(const uint8_t *const dict, const int pos);
+    static int getWordIndexAndForwardPointer(const uint8_t *const dict, const uint8_t flags,
+            int *pos);
+    static bool hasChildrenInFlags(const uint8_t flags);
+    static int readChildrenPosition(const uint8_t *const dict, const uint8_t flags,
+            const int pos);
+    static int skipChildrenPosition(const uint8_t flags, const int pos);
+
+ private:
+    DISALLOW_IMPLICIT_CONSTRUCTORS(BinaryFormat);
+};
+
+inline int BinaryFormat::readInt(const uint8_t *const dict, const int pos, const int size) {
+    int value = 0;
+    for (int i = 0; i < size; ++i) {
+        value = (value << 8) | dict[pos + i];
+    }
+    return value;
+}
+
+inline bool BinaryFormat::isValid(const uint8_t *const dict, const int dictSize) {
+    return dictSize >= HEADER_SIZE && readInt(dict, 0, 4) == MAGIC_NUMBER
+            && readInt(dict, 4, 2) == FORMAT_VERSION;
+}
+
+inline int BinaryFormat::getTableCount(const uint8_t *const dict) {
+    return readInt(dict, 6, 2);
+}
+
+inline int BinaryFormat::getGroupCountAndForwardPointer(const uint8_t *const dict, int *pos) {
+    const int msb = dict[(*pos)++];
+    if (msb < 0x80) return msb;
+    return ((msb & 0x7F) << 8) | dict[(*pos)++];
+}
+
+inline uint8_t BinaryFormat::getFlagsAndForwardPointer(const uint8_t *const dict, int *pos) {
+    return dict[(*pos)++];
+}
+
+inline int BinaryFormat::getCodePointAndForwardPointer(const uint8_t *const dict, int *pos) {
+    const int origin = *pos;
+    const int byte = dict[origin];
+    if (byte >= BENGALI_BYTE_BASE) {
+        *pos = origin + 1;
+        return BENGALI_BLOCK_START + byte - BENGALI_BYTE_BASE;
+    }
+    if (byte < MINIMAL_ONE_BYTE_CHARACTER_VALUE) {
+        if (byte == CHARACTER_ARRAY_TERMINATOR) {
+            *pos = origin + 1;
+            return NOT_A_CODE_POINT;
+        }
+        *pos = origin + 3;
+        return (byte << 16) + (dict[origin + 1] << 8) + dict[origin + 2];
+    }
+    *pos = origin + 1;
+    return byte;
+}
+
+inline int BinaryFormat::skipOtherCharacters(const uint8_t *const dict, const int pos) {
+    int currentPos = pos;
+    while (getCodePointAndForwardPointer(dict, &currentPos) != NOT_A_CODE_POINT) {
+    }
+    return currentPos;
+}
+
+inline int BinaryFormat::getWordIndexAndForwardPointer(const uint8_t *const dict,
+        const uint8_t flags, int *pos) {
+    const int size = flags & MASK_WORD_INDEX_SIZE;
+    const int index = readInt(dict, *pos, size);
+    *pos += size;
+    return index;
+}
+
+inline bool BinaryFormat::hasChildrenInFlags(const uint8_t flags) {
+    return (flags & MASK_GROUP_ADDRESS_TYPE) != FLAG_GROUP_ADDRESS_TYPE_NOADDRESS;
+}
+
+inline int BinaryFormat::readChildrenPosition(const uint8_t *const dict, const uint8_t flags,
+        const int pos) {
+    return pos + readInt(dict, pos, (flags & MASK_GROUP_ADDRESS_TYPE) >> 6);
+}
+
+inline int BinaryFormat::skipChildrenPosition(const uint8_t flags, const int pos) {
+    return pos + ((flags & MASK_GROUP_ADDRESS_TYPE) >> 6);
+}
+
+} // namespace avro
+#endif // AVRO_BINARY_FORMAT_H
@@ -0,0 +1,24 @@
+#ifndef AVRO_DEFINES_H
+#define AVRO_DEFINES_H
+
+#ifdef __ANDROID__
+#include <android/log.h>
+#define AVRO_LOGI(fmt, ...) __android_log_print(ANDROID_LOG_INFO, "avro-ndk", fmt, ##__VA_ARGS__)
+#define AVRO_LOGE(fmt, ...) __android_log_print(ANDROID_LOG_ERROR, "avro-ndk", fmt, ##__VA_ARGS__)
+#else // __ANDROID__
+#include <cstdio>
+#define AVRO_LOGI(fmt, ...) fprintf(stderr, "avro: " fmt "\n", ##__VA_ARGS__)
+#define AVRO_LOGE(fmt, ...) fprintf(stderr, "avro: error: " fmt "\n", ##__VA_ARGS__)
+#endif // __ANDROID__
+
+#define NELEMS(x) (sizeof(x) / sizeof((x)[0]))
+
+#define DISALLOW_COPY_AND_ASSIGN(TypeName) \
+  TypeName(const TypeName&);               \
+  void operator=(const TypeName&)
+
+#define DISALLOW_IMPLICIT_CONSTRUCTORS(TypeName) \
+  TypeName();                                    \
+  DISALLOW_COPY_AND_ASSIGN(TypeName)
+
+#endif // AVRO_DEFINES_H
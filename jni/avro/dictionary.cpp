@@ -0,0 +1,294 @@
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "binary_format.h"
+#include "dictionary.h"
+#include "trace.h"
+#include "utf8.h"
+
+namespace avro {
+
+// The tables dbsearch looks in for each initial letter, copied from its switch statement.
+static const char *const SEARCH_TABLES['z' - 'a' + 1] = {
+    "a aa e oi o nya y", // a
+    "b bh",              // b
+    "c ch k",            // c
+    "d dh dd ddh",       // d
+    "i ii e y",          // e
+    "ph",                // f
+    "g gh j",            // g
+    "h",                 // h
+    "i ii y",            // i
+    "j jh z",            // j
+    "k kh",              // k
+    "l",                 // l
+    "h m",               // m
+    "n nya nga nn",      // n
+    "a u uu oi o ou y",  // o
+    "p ph",              // p
+    "k",                 // q
+    "rri h r rr rrh",    // r
+    "s sh ss",           // s
+    "t th tt tth khandatta", // t
+    "u uu y",            // u
+    "bh",                // v
+    "o",                 // w
+    "e k",               // x
+    "i y",               // y
+    "h j jh z",          // z
+};
+
+Dictionary::Dictionary()
+        : mFd(-1), mDictOffset(0), mDictSize(0), mTables(), mSearchTables(), mMutex(), mRoots(),
+          mRegex(), mNfa(), mStateSets(), mWord(), mMatches() {
+    pthread_mutex_init(&mMutex, NULL);
+}
+
+Dictionary::~Dictionary() {
+    close();
+    pthread_mutex_destroy(&mMutex);
+}
+
+bool Dictionary::open(const char *path, const long offset, const long size) {
+    close();
+    mFd = ::open(path, O_RDONLY);
+    if (mFd < 0) {
+        AVRO_LOGE("Can't open %s: %d", path, errno);
+        return false;
+    }
+    mDictOffset = offset;
+    mDictSize = static_cast<int>(size);
+    if (!readHeader()) {
+        AVRO_LOGE("%s is not an Avro dictionary", path);
+        close();
+        return false;
+    }
+    findSearchTables();
+    return true;
+}
+
+void Dictionary::close() {
+    dropTables();
+    if (mFd >= 0) {
+        ::close(mFd);
+    }
+    mFd = -1;
+    mDictOffset = 0;
+    mDictSize = 0;
+    mTables.clear();
+    for (int i = 0; i < INITIALS; ++i) {
+        mSearchTables[i].clear();
+    }
+}
+
+// The table names make the header size vary, so it is read in growing steps until it all fits.
+bool Dictionary::readHeader() {
+    std::vector<uint8_t> header(std::min(mDictSize, static_cast<int>(INITIAL_HEADER_READ_SIZE)));
+    for (;;) {
+        const int headerSize = static_cast<int>(header.size());
+        if (pread(mFd, &header[0], headerSize, mDictOffset) != headerSize
+                || !BinaryFormat::isValid(&header[0], headerSize)) {
+            return false;
+        }
+        if (readTables(&header[0], headerSize)) {
+            return true;
+        }
+        mTables.clear();
+        if (headerSize == mDictSize) {
+            return false;
+        }
+        header.resize(std::min(mDictSize, headerSize * 2));
+    }
+}
+
+// False if the table list is broken, or goes on past |headerSize|.
+bool Dictionary::readTables(const uint8_t *const header, const int headerSize) {
+    const int tableCount = BinaryFormat::getTableCount(header);
+    int pos = BinaryFormat::HEADER_SIZE;
+    for (int i = 0; i < tableCount; ++i) {
+        Table table;
+        while (pos < headerSize && header[pos] != BinaryFormat::CHARACTER_ARRAY_TERMINATOR) {
+            table.name.push_back(static_cast<char>(header[pos++]));
+        }
+        ++pos;
+        if (pos + BinaryFormat::TABLE_ENTRY_SIZE > headerSize) {
+            return false;
+        }
+        table.wordCount = BinaryFormat::readInt(header, pos, 3);
+        table.offset = BinaryFormat::readInt(header, pos + 3, 4);
+        table.size = BinaryFormat::readInt(header, pos + 7, 4);
+        pos += BinaryFormat::TABLE_ENTRY_SIZE;
+        if (table.offset < pos || table.size <= 0 || table.offset > mDictSize - table.size) {
+            return false;
+        }
+        mTables.push_back(table);
+    }
+    return !mTables.empty();
+}
+
+void Dictionary::findSearchTables() {
+    for (int i = 0; i < INITIALS; ++i) {
+        const std::string prefixes = SEARCH_TABLES[i];
+        size_t start = 0;
+        while (start < prefixes.size()) {
+            size_t space = prefixes.find(' ', start);
+            if (space == std::string::npos) {
+                space = prefixes.size();
+            }
+            const int table = findTable("w_" + prefixes.substr(start, space - start));
+            start = space + 1;
+            if (table >= 0) {
+                mSearchTables[i].push_back(table);
+            }
+        }
+    }
+}
+
+int Dictionary::findTable(const std::string &name) const {
+    for (size_t i = 0; i < mTables.size(); ++i) {
+        if (mTables[i].name == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+bool Dictionary::mapTable(Table *table) {
+    // mmap wants a page aligned offset, while assets sit anywhere in the apk.
+    const long offset = mDictOffset + table->offset;
+    const long adjust = offset % getpagesize();
+    const size_t mmapSize = static_cast<size_t>(table->size + adjust);
+    void *const addr = mmap(NULL, mmapSize, PROT_READ, MAP_PRIVATE, mFd, offset - adjust);
+    if (addr == MAP_FAILED) {
+        AVRO_LOGE("Can't mmap %s: %d", table->name.c_str(), errno);
+        return false;
+    }
+    table->mmapAddr = addr;
+    table->mmapSize = mmapSize;
+    table->root = static_cast<const uint8_t *>(addr) + adjust;
+    return true;
+}
+
+int Dictionary::dropTables() {
+    pthread_mutex_lock(&mMutex);
+    int dropped = 0;
+    for (size_t i = 0; i < mTables.size(); ++i) {
+        Table *table = &mTables[i];
+        if (table->mmapAddr) {
+            munmap(table->mmapAddr, table->mmapSize);
+            table->mmapAddr = NULL;
+            table->mmapSize = 0;
+            table->root = NULL;
+            ++dropped;
+        }
+    }
+    pthread_mutex_unlock(&mMutex);
+    return dropped;
+}
+
+// Walks the group of char groups at |pos|, all of them following the |depth| code points that
+// are in |mWord| and brought the NFA to |mStateSets[depth]|.
+void Dictionary::searchGroup(const uint8_t *const root, int pos, const int depth) {
+    const int groupCount = BinaryFormat::getGroupCountAndForwardPointer(root, &pos);
+    for (int i = 0; i < groupCount; ++i) {
+        const uint8_t flags = BinaryFormat::getFlagsAndForwardPointer(root, &pos);
+        int codePoint = BinaryFormat::getCodePointAndForwardPointer(root, &pos);
+        int length = depth;
+        bool matchedAllChars = true;
+        for (;;) {
+            if (static_cast<int>(mStateSets.size()) <= length + 1) {
+                mStateSets.resize(length + 2);
+                mWord.resize(length + 1);
+            }
+            mNfa.step(mStateSets[length], codePoint, &mStateSets[length + 1]);
+            mWord[length] = codePoint;
+            ++length;
+            if (!(flags & BinaryFormat::FLAG_HAS_MULTIPLE_CHARS)) {
+                break;
+            }
+            codePoint = BinaryFormat::getCodePointAndForwardPointer(root, &pos);
+            if (codePoint == BinaryFormat::NOT_A_CODE_POINT) {
+                break;
+            }
+            if (mStateSets[length].states.empty()) {
+                matchedAllChars = false;
+                pos = BinaryFormat::skipOtherCharacters(root, pos);
+                break;
+            }
+        }
+        const bool isTerminal = flags & BinaryFormat::FLAG_IS_TERMINAL;
+        const int wordIndex = isTerminal
+                ? BinaryFormat::getWordIndexAndForwardPointer(root, flags, &pos) : 0;
+        if (matchedAllChars) {
+            // Copied out, the recursion below may grow |mStateSets|.
+            const bool accepting = mStateSets[length].accepting;
+            const bool hasLiveStates = !mStateSets[length].states.empty();
+            if (isTerminal && accepting) {
+                addMatch(wordIndex, length);
+            }
+            if (hasLiveStates && BinaryFormat::hasChildrenInFlags(flags)) {
+                searchGroup(root, BinaryFormat::readChildrenPosition(root, flags, pos), length);
+            }
+        }
+        pos = BinaryFormat::skipChildrenPosition(flags, pos);
+    }
+}
+
+void Dictionary::addMatch(const int wordIndex, const int length) {
+    mMatches.push_back(Match(wordIndex, std::string()));
+    std::string *word = &mMatches.back().second;
+    for (int i = 0; i < length; ++i) {
+        appendUtf8(mWord[i], word);
+    }
+}
+
+void Dictionary::getSearchTables(char initial, std::vector<const uint8_t *> *roots) {
+    roots->clear();
+    // dbsearch picks the tables by a.toLowerCase().charAt(0).
+    if (initial >= 'A' && initial <= 'Z') {
+        initial += 'a' - 'A';
+    }
+    if (initial < 'a' || initial > 'z') {
+        return;
+    }
+    const std::vector<int> &tables = mSearchTables[initial - 'a'];
+    pthread_mutex_lock(&mMutex);
+    for (size_t i = 0; i < tables.size(); ++i) {
+        Table *table = &mTables[tables[i]];
+        if (table->root || mapTable(table)) {
+            roots->push_back(table->root);
+        }
+    }
+    pthread_mutex_unlock(&mMutex);
+}
+
+void Dictionary::search(const std::string &input, std::vector<std::string> *results) {
+    AVRO_TRACE("dictionary.search");
+    results->clear();
+    if (input.empty()) {
+        return;
+    }
+    getSearchTables(input[0], &mRoots);
+    if (mRoots.empty()) {
+        return;
+    }
+    mRegex.compile(input, &mNfa);
+    if (mStateSets.empty()) {
+        mStateSets.resize(1);
+    }
+    for (size_t i = 0; i < mRoots.size(); ++i) {
+        mMatches.clear();
+        mNfa.start(&mStateSets[0]);
+        searchGroup(mRoots[i], 0, 0);
+        // The js scans each table front to back, so report the matches in that order.
+        std::sort(mMatches.begin(), mMatches.end());
+        for (size_t j = 0; j < mMatches.size(); ++j) {
+            results->push_back(mMatches[j].second);
+        }
+    }
+}
+
+} // namespace avro
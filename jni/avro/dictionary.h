@@ -0,0 +1,94 @@
+#ifndef AVRO_DICTIONARY_H
+#define AVRO_DICTIONARY_H
+
+#include <pthread.h>
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "defines.h"
+#include "phonetic_regex.h"
+
+namespace avro {
+
+// Native replacement for dbsearch. The avrodict tables are compiled offline into the binary
+// format described in binary_format.h, one trie per table, and mapped read only straight out
+// of the apk. The phonetic regex of the input is run as an NFA over the trie in parallel, so
+// only the branches that can still match are ever visited, and only those pages are faulted in.
+//
+// Opening only reads the header. Each table is mapped the first time a search needs it, so the
+// tables of letters that are never typed first cost nothing, and dropTables() unmaps them all
+// again when memory runs low.
+class Dictionary {
+ public:
+    Dictionary();
+    ~Dictionary();
+
+    // |offset| and |size| locate the dictionary inside |path|, which lets it be mapped from an
+    // uncompressed apk asset as well as from a file of its own.
+    bool open(const char *path, const long offset, const long size);
+    void close();
+    bool isLoaded() const {
+        return !mTables.empty();
+    }
+
+    // Same results, in the same order, as dbsearch's search().
+    void search(const std::string &input, std::vector<std::string> *results);
+    // The roots of the tables dbsearch looks in for words starting with |initial|, in either
+    // case, in order. Maps the ones not in use yet, and may be called from any thread.
+    void getSearchTables(char initial, std::vector<const uint8_t *> *roots);
+    // Unmaps the tables, and returns how many were mapped. Nothing may still be searching them,
+    // nor hold on to roots from before.
+    int dropTables();
+
+ private:
+    DISALLOW_COPY_AND_ASSIGN(Dictionary);
+
+    static const int INITIAL_HEADER_READ_SIZE = 1024;
+    static const int INITIALS = 'z' - 'a' + 1;
+
+    struct Table {
+        Table() : name(), wordCount(0), offset(0), size(0), root(NULL), mmapAddr(NULL),
+                  mmapSize(0) {}
+
+        std::string name;
+        int wordCount;
+        // Where the table is in the dictionary, and where it is mapped if it is.
+        int offset;
+        int size;
+        const uint8_t *root;
+        void *mmapAddr;
+        size_t mmapSize;
+    };
+
+    // Index of the word in its js table, and the word itself.
+    typedef std::pair<int, std::string> Match;
+
+    bool readHeader();
+    bool readTables(const uint8_t *const header, const int headerSize);
+    void findSearchTables();
+    int findTable(const std::string &name) const;
+    bool mapTable(Table *table);
+    void searchGroup(const uint8_t *const root, int pos, const int depth);
+    void addMatch(const int wordIndex, const int length);
+
+    // Kept open for mapping the tables.
+    int mFd;
+    long mDictOffset;
+    int mDictSize;
+    std::vector<Table> mTables;
+    // Indices in |mTables| of the ones dbsearch looks in, for each initial letter.
+    std::vector<int> mSearchTables[INITIALS];
+    // Guards the mapping of the tables.
+    pthread_mutex_t mMutex;
+    std::vector<const uint8_t *> mRoots;
+    const PhoneticRegex mRegex;
+    RegexNfa mNfa;
+    std::vector<NfaStateSet> mStateSets;
+    std::vector<int> mWord;
+    std::vector<Match> mMatches;
+};
+
+} // namespace avro
+#endif // AVRO_DICTIONARY_H
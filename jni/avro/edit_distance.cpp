@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <cstring>
+
+#include "edit_distance.h"
+
+namespace avro {
+
+EditDistance::EditDistance() : mPattern(), mOtherMasks(), mTable() {
+    memset(mMasks, 0, sizeof(mMasks));
+}
+
+int EditDistance::getMaskIndex(const int codePoint) {
+    if (codePoint >= 0 && codePoint < ASCII_END) {
+        return codePoint;
+    }
+    if (codePoint >= BENGALI_BLOCK_START && codePoint < BENGALI_BLOCK_END) {
+        return ASCII_END + codePoint - BENGALI_BLOCK_START;
+    }
+    return -1;
+}
+
+void EditDistance::setPattern(const std::vector<int> &pattern) {
+    // Only clear what the last pattern set.
+    for (size_t i = 0; i < mPattern.size(); ++i) {
+        const int index = getMaskIndex(mPattern[i]);
+        if (index >= 0) {
+            mMasks[index] = 0;
+        }
+    }
+    mOtherMasks.clear();
+    mPattern = pattern;
+    if (mPattern.size() > MAX_BIT_PARALLEL_LENGTH) {
+        return;
+    }
+    for (size_t i = 0; i < mPattern.size(); ++i) {
+        const uint64_t bit = static_cast<uint64_t>(1) << i;
+        const int index = getMaskIndex(mPattern[i]);
+        if (index >= 0) {
+            mMasks[index] |= bit;
+            continue;
+        }
+        size_t j = 0;
+        while (j < mOtherMasks.size() && mOtherMasks[j].first != mPattern[i]) {
+            ++j;
+        }
+        if (j == mOtherMasks.size()) {
+            mOtherMasks.push_back(std::make_pair(mPattern[i], static_cast<uint64_t>(0)));
+        }
+        mOtherMasks[j].second |= bit;
+    }
+}
+
+uint64_t EditDistance::getMask(const int codePoint) const {
+    const int index = getMaskIndex(codePoint);
+    if (index >= 0) {
+        return mMasks[index];
+    }
+    for (size_t i = 0; i < mOtherMasks.size(); ++i) {
+        if (mOtherMasks[i].first == codePoint) {
+            return mOtherMasks[i].second;
+        }
+    }
+    return 0;
+}
+
+// Bit i of the vectors stands for row i + 1 of the table, the pattern running down and the
+// word across. |verticalPositive| and |verticalNegative| hold where a column goes up or down
+// by one from the row above, and |score| follows the bottom row along.
+int EditDistance::getDistance(const std::vector<int> &word) {
+    const int m = static_cast<int>(mPattern.size());
+    const int n = static_cast<int>(word.size());
+    if (m == 0 || n == 0) {
+        return m + n;
+    }
+    if (m > MAX_BIT_PARALLEL_LENGTH) {
+        return getDistanceByTable(word);
+    }
+    const uint64_t all = m == 64 ? ~static_cast<uint64_t>(0)
+            : (static_cast<uint64_t>(1) << m) - 1;
+    const uint64_t last = static_cast<uint64_t>(1) << (m - 1);
+    uint64_t verticalPositive = all;
+    uint64_t verticalNegative = 0;
+    uint64_t diagonalZero = 0;
+    uint64_t previousMask = 0;
+    int score = m;
+    for (int j = 0; j < n; ++j) {
+        const uint64_t mask = getMask(word[j]);
+        // Where the pattern and the word have two characters swapped.
+        const uint64_t transposed = (((~diagonalZero) & mask) << 1) & previousMask;
+        diagonalZero = ((((mask & verticalPositive) + verticalPositive) ^ verticalPositive)
+                | mask | verticalNegative | transposed) & all;
+        const uint64_t horizontalPositive =
+                (verticalNegative | ~(diagonalZero | verticalPositive)) & all;
+        const uint64_t horizontalNegative = diagonalZero & verticalPositive;
+        if (horizontalPositive & last) {
+            ++score;
+        } else if (horizontalNegative & last) {
+            --score;
+        }
+        // The top row goes up by one at every step, hence the carry in.
+        const uint64_t shifted = (horizontalPositive << 1) | 1;
+        verticalNegative = shifted & diagonalZero;
+        verticalPositive = ((horizontalNegative << 1) | ~(shifted | diagonalZero)) & all;
+        previousMask = mask;
+    }
+    return score;
+}
+
+int EditDistance::getDistanceByTable(const std::vector<int> &word) {
+    const std::vector<int> &a = mPattern;
+    const std::vector<int> &b = word;
+    const int n = static_cast<int>(a.size());
+    const int m = static_cast<int>(b.size());
+    const int width = m + 1;
+    mTable.resize((n + 1) * width);
+    int *const d = &mTable[0];
+    for (int i = 0; i <= n; ++i) {
+        d[i * width] = i;
+    }
+    for (int j = 0; j <= m; ++j) {
+        d[j] = j;
+    }
+    for (int i = 1; i <= n; ++i) {
+        for (int j = 1; j <= m; ++j) {
+            const int cost = a[i - 1] == b[j - 1] ? 0 : 1;
+            int distance = std::min(d[(i - 1) * width + j], d[i * width + j - 1]) + 1;
+            distance = std::min(distance, d[(i - 1) * width + j - 1] + cost);
+            if (i > 1 && j > 1 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1]) {
+                distance = std::min(distance, d[(i - 2) * width + j - 2] + cost);
+            }
+            d[i * width + j] = distance;
+        }
+    }
+    return d[n * width + m];
+}
+
+} // namespace avro
@@ -0,0 +1,50 @@
+#ifndef AVRO_EDIT_DISTANCE_H
+#define AVRO_EDIT_DISTANCE_H
+
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+#include "defines.h"
+
+namespace avro {
+
+// The js levenshtein(), which is really the optimal string alignment distance: swapping two
+// adjacent characters counts as a single edit. Meant for measuring many words against the same
+// pattern, as ranking the candidates does.
+//
+// Uses Hyyrö's bit-parallel version of Myers' algorithm, extended with transpositions, so a
+// word costs one pass of a few word-sized operations per code point instead of filling a
+// table. The match masks of the pattern are built once in setPattern(). Patterns longer than
+// 64 code points fall back to the table.
+class EditDistance {
+ public:
+    EditDistance();
+
+    void setPattern(const std::vector<int> &pattern);
+    int getDistance(const std::vector<int> &word);
+
+ private:
+    DISALLOW_COPY_AND_ASSIGN(EditDistance);
+
+    static const int MAX_BIT_PARALLEL_LENGTH = 64;
+    // Match masks are kept in an array for ascii and the Bengali block, which is all the
+    // candidates ever hold, and in |mOtherMasks| for the rest.
+    static const int ASCII_END = 0x80;
+    static const int BENGALI_BLOCK_START = 0x0980;
+    static const int BENGALI_BLOCK_END = 0x0A00;
+    static const int DIRECT_MASK_COUNT = ASCII_END + BENGALI_BLOCK_END - BENGALI_BLOCK_START;
+
+    static int getMaskIndex(const int codePoint);
+
+    uint64_t getMask(const int codePoint) const;
+    int getDistanceByTable(const std::vector<int> &word);
+
+    std::vector<int> mPattern;
+    uint64_t mMasks[DIRECT_MASK_COUNT];
+    std::vector<std::pair<int, uint64_t> > mOtherMasks;
+    std::vector<int> mTable;
+};
+
+} // namespace avro
+#endif // AVRO_EDIT_DISTANCE_H
@@ -0,0 +1,115 @@
+#ifndef AVRO_LRU_CACHE_H
+#define AVRO_LRU_CACHE_H
+
+#include <stddef.h>
+#include <list>
+#include <map>
+#include <string>
+
+#include "defines.h"
+
+namespace avro {
+
+struct CacheStats {
+    CacheStats() : hits(0), misses(0), evictions(0), entries(0), bytes(0), capacity(0) {}
+
+    int hits;
+    int misses;
+    int evictions;
+    int entries;
+    size_t bytes;
+    size_t capacity;
+};
+
+// A string keyed cache that holds at most |capacity| bytes, as estimated by whoever puts the
+// values in, and drops the least recently used entries to stay under it.
+template <typename Value>
+class LruCache {
+ public:
+    explicit LruCache(const size_t capacity) : mEntries(), mIndex(), mStats() {
+        mStats.capacity = capacity;
+    }
+
+    // Returns NULL if |key| is not cached. The value stays valid until the next put().
+    const Value *get(const std::string &key) {
+        const typename Index::iterator it = mIndex.find(key);
+        if (it == mIndex.end()) {
+            ++mStats.misses;
+            return NULL;
+        }
+        ++mStats.hits;
+        mEntries.splice(mEntries.begin(), mEntries, it->second);
+        return &it->second->value;
+    }
+
+    // Neither counted as a hit or a miss, nor making the entry any more recent.
+    bool contains(const std::string &key) const {
+        return mIndex.find(key) != mIndex.end();
+    }
+
+    // |size| is what the value costs besides the key and the bookkeeping.
+    void put(const std::string &key, const Value &value, const size_t size) {
+        const typename Index::iterator it = mIndex.find(key);
+        if (it != mIndex.end()) {
+            remove(it);
+        }
+        const size_t bytes = key.size() * 2 + size + ENTRY_OVERHEAD;
+        if (bytes > mStats.capacity) {
+            return;
+        }
+        while (mStats.bytes + bytes > mStats.capacity) {
+            typename Index::iterator last = mIndex.find(mEntries.back().key);
+            remove(last);
+            ++mStats.evictions;
+        }
+        mEntries.push_front(Entry(key, bytes));
+        mEntries.front().value = value;
+        mIndex[key] = mEntries.begin();
+        mStats.bytes += bytes;
+        ++mStats.entries;
+    }
+
+    void clear() {
+        mEntries.clear();
+        mIndex.clear();
+        mStats.entries = 0;
+        mStats.bytes = 0;
+    }
+
+    const CacheStats &getStats() const {
+        return mStats;
+    }
+
+ private:
+    DISALLOW_IMPLICIT_CONSTRUCTORS(LruCache);
+
+    // Roughly what a list node and a map node take, on top of the key and the value.
+    static const size_t ENTRY_OVERHEAD = 64;
+
+    struct Entry {
+        Entry(const std::string &entryKey, const size_t entryBytes)
+                : key(entryKey), value(), bytes(entryBytes) {}
+
+        std::string key;
+        Value value;
+        size_t bytes;
+    };
+
+    // Most recently used first.
+    typedef std::list<Entry> EntryList;
+    typedef std::map<std::string, typename EntryList::iterator> Index;
+
+    void remove(const typename Index::iterator &it) {
+        mStats.bytes -= it->second->bytes;
+        --mStats.entries;
+        mEntries.erase(it->second);
+        mIndex.erase(it);
+    }
+
+    EntryList mEntries;
+    Index mIndex;
+    CacheStats mStats;
+};
+
+} // namespace avro
+#endif // AVRO_LRU_CACHE_H
@@ -0,0 +1,182 @@
+#include <cstring>
+
+#include "phonetic.h"
+
+namespace avro {
+
+static inline char toAsciiLower(const char c) {
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+}
+
+static inline bool containsChar(const char *set, const char c) {
+    return c != '\0' && strchr(set, c) != NULL;
+}
+
+PhoneticParser::PhoneticParser(const PhoneticData *data) : mData(data), mTrie() {
+    const TrieNode root = { '\0', NOT_A_PATTERN, -1, -1 };
+    mTrie.push_back(root);
+    for (int i = 0; i < mData->patternCount; ++i) {
+        addPattern(i);
+    }
+}
+
+void PhoneticParser::addPattern(const int patternIndex) {
+    int node = 0;
+    for (const char *find = mData->patterns[patternIndex].find; *find; ++find) {
+        int child = findChild(node, *find);
+        if (child < 0) {
+            child = static_cast<int>(mTrie.size());
+            const TrieNode newNode = { *find, NOT_A_PATTERN, -1, mTrie[node].firstChild };
+            mTrie.push_back(newNode);
+            mTrie[node].firstChild = child;
+        }
+        node = child;
+    }
+    // Like the linear scan in the js, the first pattern listed for a "find" wins.
+    if (mTrie[node].pattern == NOT_A_PATTERN) {
+        mTrie[node].pattern = patternIndex;
+    }
+}
+
+int PhoneticParser::findChild(const int node, const char c) const {
+    for (int child = mTrie[node].firstChild; child >= 0; child = mTrie[child].nextSibling) {
+        if (mTrie[child].c == c) {
+            return child;
+        }
+    }
+    return -1;
+}
+
+bool PhoneticParser::isVowel(const char c) const {
+    return containsChar(mData->vowel, toAsciiLower(c));
+}
+
+bool PhoneticParser::isConsonant(const char c) const {
+    return containsChar(mData->consonant, toAsciiLower(c));
+}
+
+bool PhoneticParser::isPunctuation(const char c) const {
+    return !(isVowel(c) || isConsonant(c));
+}
+
+bool PhoneticParser::isCaseSensitive(const char c) const {
+    return containsChar(mData->caseSensitive, toAsciiLower(c));
+}
+
+bool PhoneticParser::isIgnored(const char c) const {
+    return containsChar(mData->ignore, toAsciiLower(c));
+}
+
+// Mirrors avrolib's isExact(), including its "end < length" check which never lets an exact
+// match touch the end of the input.
+bool PhoneticParser::isExact(const char *value, const std::string &text, const int start,
+        const int end, const bool negative) const {
+    const bool matched = start >= 0 && end < static_cast<int>(text.size())
+            && text.compare(start, end - start, value) == 0;
+    return matched != negative;
+}
+
+bool PhoneticParser::matchesRule(const PhoneticRule *rule, const std::string &text,
+        const int start, const int end) const {
+    const int length = static_cast<int>(text.size());
+    for (int i = 0; i < rule->matchCount; ++i) {
+        const PhoneticMatch *match = &rule->matches[i];
+        const bool isSuffix = match->type == MATCH_TYPE_SUFFIX;
+        const int pos = isSuffix ? end : start - 1;
+        bool matched;
+        switch (match->scope) {
+        case MATCH_SCOPE_PUNCTUATION:
+            matched = (pos < 0 && !isSuffix) || (pos >= length && isSuffix)
+                    || (pos >= 0 && pos < length && isPunctuation(text[pos]));
+            break;
+        case MATCH_SCOPE_VOWEL:
+            matched = ((pos >= 0 && !isSuffix) || (pos < length && isSuffix))
+                    && isVowel(text[pos]);
+            break;
+        case MATCH_SCOPE_CONSONANT:
+            matched = ((pos >= 0 && !isSuffix) || (pos < length && isSuffix))
+                    && isConsonant(text[pos]);
+            break;
+        case MATCH_SCOPE_EXACT: {
+            const int valueLength = static_cast<int>(strlen(match->value));
+            const int exactStart = isSuffix ? end : start - valueLength;
+            const int exactEnd = isSuffix ? end + valueLength : start;
+            // isExact() already accounts for negation.
+            if (!isExact(match->value, text, exactStart, exactEnd, match->negative)) {
+                return false;
+            }
+            continue;
+        }
+        default:
+            return false;
+        }
+        if (matched == match->negative) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const char *PhoneticParser::matchAt(const std::string &text, const int pos, int *end) const {
+    const int length = static_cast<int>(text.size());
+    // The js takes the first pattern in list order that matches, so among all the terminals
+    // on the path pick the one listed first rather than simply the longest.
+    int best = NOT_A_PATTERN;
+    int bestEnd = pos;
+    int node = 0;
+    for (int i = pos; i < length; ++i) {
+        node = findChild(node, text[i]);
+        if (node < 0) {
+            break;
+        }
+        const int pattern = mTrie[node].pattern;
+        if (pattern != NOT_A_PATTERN && (best == NOT_A_PATTERN || pattern < best)) {
+            best = pattern;
+            bestEnd = i + 1;
+        }
+    }
+    if (best == NOT_A_PATTERN) {
+        return NULL;
+    }
+    const PhoneticPattern *pattern = &mData->patterns[best];
+    *end = bestEnd;
+    for (int j = 0; j < pattern->ruleCount; ++j) {
+        const PhoneticRule *rule = &pattern->rules[j];
+        if (matchesRule(rule, text, pos, bestEnd)) {
+            return rule->replace;
+        }
+    }
+    return pattern->replace;
+}
+
+void PhoneticParser::fixString(const std::string &input, std::string *output) const {
+    output->clear();
+    output->reserve(input.size());
+    for (size_t i = 0; i < input.size(); ++i) {
+        const char c = input[i];
+        if (isIgnored(c)) {
+            continue;
+        }
+        output->push_back(isCaseSensitive(c) ? c : toAsciiLower(c));
+    }
+}
+
+void PhoneticParser::parse(const std::string &input, std::string *output) const {
+    std::string text;
+    fixString(input, &text);
+    output->clear();
+    const int length = static_cast<int>(text.size());
+    for (int pos = 0; pos < length;) {
+        int end = 0;
+        const char *replace = matchAt(text, pos, &end);
+        if (replace) {
+            output->append(replace);
+            pos = end;
+        } else {
+            output->push_back(text[pos]);
+            ++pos;
+        }
+    }
+}
+
+} // namespace avro
@@ -0,0 +1,107 @@
+#ifndef AVRO_PHONETIC_H
+#define AVRO_PHONETIC_H
+
+#include <string>
+#include <vector>
+
+#include "defines.h"
+
+namespace avro {
+
+typedef enum {
+    MATCH_TYPE_PREFIX,
+    MATCH_TYPE_SUFFIX,
+} MatchType;
+
+typedef enum {
+    MATCH_SCOPE_PUNCTUATION,
+    MATCH_SCOPE_VOWEL,
+    MATCH_SCOPE_CONSONANT,
+    MATCH_SCOPE_EXACT,
+} MatchScope;
+
+// One entry of a rule's "matches" list. The "!" prefix of the scope in the js tables is
+// already folded into |negative|.
+struct PhoneticMatch {
+    MatchType type;
+    MatchScope scope;
+    bool negative;
+    const char *value;
+};
+
+struct PhoneticRule {
+    const PhoneticMatch *matches;
+    int matchCount;
+    const char *replace;
+};
+
+struct PhoneticPattern {
+    const char *find;
+    const char *replace;
+    const PhoneticRule *rules;
+    int ruleCount;
+};
+
+struct PhoneticData {
+    const PhoneticPattern *patterns;
+    int patternCount;
+    const char *vowel;
+    const char *consonant;
+    const char *caseSensitive;
+    const char *ignore;
+};
+
+// The avrolib OmicronLab.Avro.Phonetic tables from assets/avro.min.js, see phonetic_data.cpp.
+extern const PhoneticData AVRO_PHONETIC_DATA;
+// The avroregexlib AvroRegex tables, whose replacements are regular expressions that match
+// every spelling of the input in the dictionary.
+extern const PhoneticData AVRO_REGEX_DATA;
+
+// Native port of avrolib's Phonetic.parse(). Input and output are UTF-8. Patterns only ever
+// contain ascii, so non-ascii input is copied through unchanged just like the js version does.
+//
+// The js walks the whole pattern list at every input position. Here the "find" strings are
+// compiled into a trie once, and each terminal node points at the pattern (and so the rules)
+// it stands for, so a match costs one walk down the trie from the current position.
+class PhoneticParser {
+ public:
+    explicit PhoneticParser(const PhoneticData *data);
+
+    void parse(const std::string &input, std::string *output) const;
+    void fixString(const std::string &input, std::string *output) const;
+
+    // Finds the pattern that applies at |pos| of an already fixed |text|. Returns the
+    // replacement and sets |end| past the matched input, or returns NULL if nothing matched.
+    const char *matchAt(const std::string &text, const int pos, int *end) const;
+
+ private:
+    DISALLOW_IMPLICIT_CONSTRUCTORS(PhoneticParser);
+
+    static const int NOT_A_PATTERN = -1;
+
+    // Children of a node are chained through |nextSibling|, the root is node 0.
+    struct TrieNode {
+        char c;
+        int pattern;
+        int firstChild;
+        int nextSibling;
+    };
+
+    void addPattern(const int patternIndex);
+    int findChild(const int node, const char c) const;
+    bool isVowel(const char c) const;
+    bool isConsonant(const char c) const;
+    bool isPunctuation(const char c) const;
+    bool isCaseSensitive(const char c) const;
+    bool isIgnored(const char c) const;
+    bool isExact(const char *value, const std::string &text, const int start, const int end,
+            const bool negative) const;
+    bool matchesRule(const PhoneticRule *rule, const std::string &text, const int start,
+            const int end) const;
+
+    const PhoneticData *const mData;
+    std::vector<TrieNode> mTrie;
+};
+
+} // namespace avro
+#endif // AVRO_PHONETIC_H
@@ -0,0 +1,728 @@
+// Generated by jni/avro/tools/avrodata.js from assets/avro.min.js, do not edit.
+
+#include <cstddef>
+
+#include "phonetic.h"
+
+namespace avro {
+
+static const PhoneticMatch PHONETIC_MATCHES_178_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, true, "" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_178_1[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+};
+static const PhoneticRule PHONETIC_RULES_178[] = {
+    { PHONETIC_MATCHES_178_0, NELEMS(PHONETIC_MATCHES_178_0), "ঐ" },
+    { PHONETIC_MATCHES_178_1, NELEMS(PHONETIC_MATCHES_178_1), "ঐ" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_179_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, true, "" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_179_1[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+};
+static const PhoneticRule PHONETIC_RULES_179[] = {
+    { PHONETIC_MATCHES_179_0, NELEMS(PHONETIC_MATCHES_179_0), "ঔ" },
+    { PHONETIC_MATCHES_179_1, NELEMS(PHONETIC_MATCHES_179_1), "ঔ" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_180_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, true, "" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_180_1[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+};
+static const PhoneticRule PHONETIC_RULES_180[] = {
+    { PHONETIC_MATCHES_180_0, NELEMS(PHONETIC_MATCHES_180_0), "ও" },
+    { PHONETIC_MATCHES_180_1, NELEMS(PHONETIC_MATCHES_180_1), "ও" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_193_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, true, "" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_193_1[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+};
+static const PhoneticRule PHONETIC_RULES_193[] = {
+    { PHONETIC_MATCHES_193_0, NELEMS(PHONETIC_MATCHES_193_0), "ঋ" },
+    { PHONETIC_MATCHES_193_1, NELEMS(PHONETIC_MATCHES_193_1), "ঋ" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_196_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, false, "" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, true, "r" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, true, "y" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, true, "w" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, true, "x" },
+};
+static const PhoneticRule PHONETIC_RULES_196[] = {
+    { PHONETIC_MATCHES_196_0, NELEMS(PHONETIC_MATCHES_196_0), "্র্য" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_197_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, false, "" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, true, "r" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, true, "y" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, true, "w" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, true, "x" },
+};
+static const PhoneticRule PHONETIC_RULES_197[] = {
+    { PHONETIC_MATCHES_197_0, NELEMS(PHONETIC_MATCHES_197_0), "্র্য" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_198_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, true, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_VOWEL, true, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "r" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_PUNCTUATION, true, "" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_198_1[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, false, "" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, true, "r" },
+};
+static const PhoneticRule PHONETIC_RULES_198[] = {
+    { PHONETIC_MATCHES_198_0, NELEMS(PHONETIC_MATCHES_198_0), "র্" },
+    { PHONETIC_MATCHES_198_1, NELEMS(PHONETIC_MATCHES_198_1), "্রর" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_202_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, false, "" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, true, "r" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, true, "y" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, true, "w" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, true, "x" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, true, "Z" },
+};
+static const PhoneticRule PHONETIC_RULES_202[] = {
+    { PHONETIC_MATCHES_202_0, NELEMS(PHONETIC_MATCHES_202_0), "্র" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_242_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, true, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_242_1[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticRule PHONETIC_RULES_242[] = {
+    { PHONETIC_MATCHES_242_0, NELEMS(PHONETIC_MATCHES_242_0), "উ" },
+    { PHONETIC_MATCHES_242_1, NELEMS(PHONETIC_MATCHES_242_1), "উ" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_245_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_VOWEL, false, "" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, true, "o" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_245_1[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_VOWEL, false, "" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, false, "o" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_245_2[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+};
+static const PhoneticRule PHONETIC_RULES_245[] = {
+    { PHONETIC_MATCHES_245_0, NELEMS(PHONETIC_MATCHES_245_0), "ও" },
+    { PHONETIC_MATCHES_245_1, NELEMS(PHONETIC_MATCHES_245_1), "অ" },
+    { PHONETIC_MATCHES_245_2, NELEMS(PHONETIC_MATCHES_245_2), "অ" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_261_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_261_1[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, true, "" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, true, "a" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_261_2[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_EXACT, false, "a" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticRule PHONETIC_RULES_261[] = {
+    { PHONETIC_MATCHES_261_0, NELEMS(PHONETIC_MATCHES_261_0), "আ" },
+    { PHONETIC_MATCHES_261_1, NELEMS(PHONETIC_MATCHES_261_1), "য়া" },
+    { PHONETIC_MATCHES_261_2, NELEMS(PHONETIC_MATCHES_261_2), "আ" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_263_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, true, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_263_1[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticRule PHONETIC_RULES_263[] = {
+    { PHONETIC_MATCHES_263_0, NELEMS(PHONETIC_MATCHES_263_0), "ই" },
+    { PHONETIC_MATCHES_263_1, NELEMS(PHONETIC_MATCHES_263_1), "ই" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_265_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, true, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_265_1[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticRule PHONETIC_RULES_265[] = {
+    { PHONETIC_MATCHES_265_0, NELEMS(PHONETIC_MATCHES_265_0), "ঈ" },
+    { PHONETIC_MATCHES_265_1, NELEMS(PHONETIC_MATCHES_265_1), "ঈ" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_267_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, true, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_267_1[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticRule PHONETIC_RULES_267[] = {
+    { PHONETIC_MATCHES_267_0, NELEMS(PHONETIC_MATCHES_267_0), "উ" },
+    { PHONETIC_MATCHES_267_1, NELEMS(PHONETIC_MATCHES_267_1), "উ" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_269_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, true, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_269_1[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticRule PHONETIC_RULES_269[] = {
+    { PHONETIC_MATCHES_269_0, NELEMS(PHONETIC_MATCHES_269_0), "ঊ" },
+    { PHONETIC_MATCHES_269_1, NELEMS(PHONETIC_MATCHES_269_1), "ঊ" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_271_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, true, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_271_1[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticRule PHONETIC_RULES_271[] = {
+    { PHONETIC_MATCHES_271_0, NELEMS(PHONETIC_MATCHES_271_0), "ঈ" },
+    { PHONETIC_MATCHES_271_1, NELEMS(PHONETIC_MATCHES_271_1), "ঈ" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_273_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, true, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_273_1[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_EXACT, true, "`" },
+};
+static const PhoneticRule PHONETIC_RULES_273[] = {
+    { PHONETIC_MATCHES_273_0, NELEMS(PHONETIC_MATCHES_273_0), "এ" },
+    { PHONETIC_MATCHES_273_1, NELEMS(PHONETIC_MATCHES_273_1), "এ" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_276_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, true, "" },
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, true, "" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_276_1[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+};
+static const PhoneticRule PHONETIC_RULES_276[] = {
+    { PHONETIC_MATCHES_276_0, NELEMS(PHONETIC_MATCHES_276_0), "য়" },
+    { PHONETIC_MATCHES_276_1, NELEMS(PHONETIC_MATCHES_276_1), "ইয়" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_279_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+    { MATCH_TYPE_SUFFIX, MATCH_SCOPE_VOWEL, false, "" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_279_1[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_CONSONANT, false, "" },
+};
+static const PhoneticRule PHONETIC_RULES_279[] = {
+    { PHONETIC_MATCHES_279_0, NELEMS(PHONETIC_MATCHES_279_0), "ওয়" },
+    { PHONETIC_MATCHES_279_1, NELEMS(PHONETIC_MATCHES_279_1), "্ব" },
+};
+static const PhoneticMatch PHONETIC_MATCHES_280_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+};
+static const PhoneticRule PHONETIC_RULES_280[] = {
+    { PHONETIC_MATCHES_280_0, NELEMS(PHONETIC_MATCHES_280_0), "এক্স" },
+};
+
+static const PhoneticPattern PHONETIC_PATTERNS[] = {
+    { "bhl", "ভ্ল", NULL, 0 },
+    { "psh", "পশ", NULL, 0 },
+    { "bdh", "ব্ধ", NULL, 0 },
+    { "bj", "ব্জ", NULL, 0 },
+    { "bd", "ব্দ", NULL, 0 },
+    { "bb", "ব্ব", NULL, 0 },
+    { "bl", "ব্ল", NULL, 0 },
+    { "bh", "ভ", NULL, 0 },
+    { "vl", "ভ্ল", NULL, 0 },
+    { "b", "ব", NULL, 0 },
+    { "v", "ভ", NULL, 0 },
+    { "cNG", "চ্ঞ", NULL, 0 },
+    { "cch", "চ্ছ", NULL, 0 },
+    { "cc", "চ্চ", NULL, 0 },
+    { "ch", "ছ", NULL, 0 },
+    { "c", "চ", NULL, 0 },
+    { "dhn", "ধ্ন", NULL, 0 },
+    { "dhm", "ধ্ম", NULL, 0 },
+    { "dgh", "দ্ঘ", NULL, 0 },
+    { "ddh", "দ্ধ", NULL, 0 },
+    { "dbh", "দ্ভ", NULL, 0 },
+    { "dv", "দ্ভ", NULL, 0 },
+    { "dm", "দ্ম", NULL, 0 },
+    { "DD", "ড্ড", NULL, 0 },
+    { "Dh", "ঢ", NULL, 0 },
+    { "dh", "ধ", NULL, 0 },
+    { "dg", "দ্গ", NULL, 0 },
+    { "dd", "দ্দ", NULL, 0 },
+    { "D", "ড", NULL, 0 },
+    { "d", "দ", NULL, 0 },
+    { "...", "...", NULL, 0 },
+    { ".`", ".", NULL, 0 },
+    { "..", "।।", NULL, 0 },
+    { ".", "।", NULL, 0 },
+    { "ghn", "ঘ্ন", NULL, 0 },
+    { "Ghn", "ঘ্ন", NULL, 0 },
+    { "gdh", "গ্ধ", NULL, 0 },
+    { "Gdh", "গ্ধ", NULL, 0 },
+    { "gN", "গ্ণ", NULL, 0 },
+    { "GN", "গ্ণ", NULL, 0 },
+    { "gn", "গ্ন", NULL, 0 },
+    { "Gn", "গ্ন", NULL, 0 },
+    { "gm", "গ্ম", NULL, 0 },
+    { "Gm", "গ্ম", NULL, 0 },
+    { "gl", "গ্ল", NULL, 0 },
+    { "Gl", "গ্ল", NULL, 0 },
+    { "gg", "জ্ঞ", NULL, 0 },
+    { "GG", "জ্ঞ", NULL, 0 },
+    { "Gg", "জ্ঞ", NULL, 0 },
+    { "gG", "জ্ঞ", NULL, 0 },
+    { "gh", "ঘ", NULL, 0 },
+    { "Gh", "ঘ", NULL, 0 },
+    { "g", "গ", NULL, 0 },
+    { "G", "গ", NULL, 0 },
+    { "hN", "হ্ণ", NULL, 0 },
+    { "hn", "হ্ন", NULL, 0 },
+    { "hm", "হ্ম", NULL, 0 },
+    { "hl", "হ্ল", NULL, 0 },
+    { "h", "হ", NULL, 0 },
+    { "jjh", "জ্ঝ", NULL, 0 },
+    { "jNG", "জ্ঞ", NULL, 0 },
+    { "jh", "ঝ", NULL, 0 },
+    { "jj", "জ্জ", NULL, 0 },
+    { "j", "জ", NULL, 0 },
+    { "J", "জ", NULL, 0 },
+    { "kkhN", "ক্ষ্ণ", NULL, 0 },
+    { "kShN", "ক্ষ্ণ", NULL, 0 },
+    { "kkhm", "ক্ষ্ম", NULL, 0 },
+    { "kShm", "ক্ষ্ম", NULL, 0 },
+    { "kxN", "ক্ষ্ণ", NULL, 0 },
+    { "kxm", "ক্ষ্ম", NULL, 0 },
+    { "kkh", "ক্ষ", NULL, 0 },
+    { "kSh", "ক্ষ", NULL, 0 },
+    { "ksh", "কশ", NULL, 0 },
+    { "kx", "ক্ষ", NULL, 0 },
+    { "kk", "ক্ক", NULL, 0 },
+    { "kT", "ক্ট", NULL, 0 },
+    { "kt", "ক্ত", NULL, 0 },
+    { "kl", "ক্ল", NULL, 0 },
+    { "ks", "ক্স", NULL, 0 },
+    { "kh", "খ", NULL, 0 },
+    { "k", "ক", NULL, 0 },
+    { "lbh", "ল্ভ", NULL, 0 },
+    { "ldh", "ল্ধ", NULL, 0 },
+    { "lkh", "লখ", NULL, 0 },
+    { "lgh", "লঘ", NULL, 0 },
+    { "lph", "লফ", NULL, 0 },
+    { "lk", "ল্ক", NULL, 0 },
+    { "lg", "ল্গ", NULL, 0 },
+    { "lT", "ল্ট", NULL, 0 },
+    { "lD", "ল্ড", NULL, 0 },
+    { "lp", "ল্প", NULL, 0 },
+    { "lv", "ল্ভ", NULL, 0 },
+    { "lm", "ল্ম", NULL, 0 },
+    { "ll", "ল্ল", NULL, 0 },
+    { "lb", "ল্ব", NULL, 0 },
+    { "l", "ল", NULL, 0 },
+    { "mth", "ম্থ", NULL, 0 },
+    { "mph", "ম্ফ", NULL, 0 },
+    { "mbh", "ম্ভ", NULL, 0 },
+    { "mpl", "মপ্ল", NULL, 0 },
+    { "mn", "ম্ন", NULL, 0 },
+    { "mp", "ম্প", NULL, 0 },
+    { "mv", "ম্ভ", NULL, 0 },
+    { "mm", "ম্ম", NULL, 0 },
+    { "ml", "ম্ল", NULL, 0 },
+    { "mb", "ম্ব", NULL, 0 },
+    { "mf", "ম্ফ", NULL, 0 },
+    { "m", "ম", NULL, 0 },
+    { "0", "০", NULL, 0 },
+    { "1", "১", NULL, 0 },
+    { "2", "২", NULL, 0 },
+    { "3", "৩", NULL, 0 },
+    { "4", "৪", NULL, 0 },
+    { "5", "৫", NULL, 0 },
+    { "6", "৬", NULL, 0 },
+    { "7", "৭", NULL, 0 },
+    { "8", "৮", NULL, 0 },
+    { "9", "৯", NULL, 0 },
+    { "NgkSh", "ঙ্ক্ষ", NULL, 0 },
+    { "Ngkkh", "ঙ্ক্ষ", NULL, 0 },
+    { "NGch", "ঞ্ছ", NULL, 0 },
+    { "Nggh", "ঙ্ঘ", NULL, 0 },
+    { "Ngkh", "ঙ্খ", NULL, 0 },
+    { "NGjh", "ঞ্ঝ", NULL, 0 },
+    { "ngOU", "ঙ্গৌ", NULL, 0 },
+    { "ngOI", "ঙ্গৈ", NULL, 0 },
+    { "Ngkx", "ঙ্ক্ষ", NULL, 0 },
+    { "NGc", "ঞ্চ", NULL, 0 },
+    { "nch", "ঞ্ছ", NULL, 0 },
+    { "njh", "ঞ্ঝ", NULL, 0 },
+    { "ngh", "ঙ্ঘ", NULL, 0 },
+    { "Ngk", "ঙ্ক", NULL, 0 },
+    { "Ngx", "ঙ্ষ", NULL, 0 },
+    { "Ngg", "ঙ্গ", NULL, 0 },
+    { "Ngm", "ঙ্ম", NULL, 0 },
+    { "NGj", "ঞ্জ", NULL, 0 },
+    { "ndh", "ন্ধ", NULL, 0 },
+    { "nTh", "ন্ঠ", NULL, 0 },
+    { "NTh", "ণ্ঠ", NULL, 0 },
+    { "nth", "ন্থ", NULL, 0 },
+    { "nkh", "ঙ্খ", NULL, 0 },
+    { "ngo", "ঙ্গ", NULL, 0 },
+    { "nga", "ঙ্গা", NULL, 0 },
+    { "ngi", "ঙ্গি", NULL, 0 },
+    { "ngI", "ঙ্গী", NULL, 0 },
+    { "ngu", "ঙ্গু", NULL, 0 },
+    { "ngU", "ঙ্গূ", NULL, 0 },
+    { "nge", "ঙ্গে", NULL, 0 },
+    { "ngO", "ঙ্গো", NULL, 0 },
+    { "NDh", "ণ্ঢ", NULL, 0 },
+    { "nsh", "নশ", NULL, 0 },
+    { "Ngr", "ঙর", NULL, 0 },
+    { "NGr", "ঞর", NULL, 0 },
+    { "ngr", "ংর", NULL, 0 },
+    { "nj", "ঞ্জ", NULL, 0 },
+    { "Ng", "ঙ", NULL, 0 },
+    { "NG", "ঞ", NULL, 0 },
+    { "nk", "ঙ্ক", NULL, 0 },
+    { "ng", "ং", NULL, 0 },
+    { "nn", "ন্ন", NULL, 0 },
+    { "NN", "ণ্ণ", NULL, 0 },
+    { "Nn", "ণ্ন", NULL, 0 },
+    { "nm", "ন্ম", NULL, 0 },
+    { "Nm", "ণ্ম", NULL, 0 },
+    { "nd", "ন্দ", NULL, 0 },
+    { "nT", "ন্ট", NULL, 0 },
+    { "NT", "ণ্ট", NULL, 0 },
+    { "nD", "ন্ড", NULL, 0 },
+    { "ND", "ণ্ড", NULL, 0 },
+    { "nt", "ন্ত", NULL, 0 },
+    { "ns", "ন্স", NULL, 0 },
+    { "nc", "ঞ্চ", NULL, 0 },
+    { "n", "ন", NULL, 0 },
+    { "N", "ণ", NULL, 0 },
+    { "OI`", "ৈ", NULL, 0 },
+    { "OU`", "ৌ", NULL, 0 },
+    { "O`", "ো", NULL, 0 },
+    { "OI", "ৈ", PHONETIC_RULES_178, NELEMS(PHONETIC_RULES_178) },
+    { "OU", "ৌ", PHONETIC_RULES_179, NELEMS(PHONETIC_RULES_179) },
+    { "O", "ো", PHONETIC_RULES_180, NELEMS(PHONETIC_RULES_180) },
+    { "phl", "ফ্ল", NULL, 0 },
+    { "pT", "প্ট", NULL, 0 },
+    { "pt", "প্ত", NULL, 0 },
+    { "pn", "প্ন", NULL, 0 },
+    { "pp", "প্প", NULL, 0 },
+    { "pl", "প্ল", NULL, 0 },
+    { "ps", "প্স", NULL, 0 },
+    { "ph", "ফ", NULL, 0 },
+    { "fl", "ফ্ল", NULL, 0 },
+    { "f", "ফ", NULL, 0 },
+    { "p", "প", NULL, 0 },
+    { "rri`", "ৃ", NULL, 0 },
+    { "rri", "ৃ", PHONETIC_RULES_193, NELEMS(PHONETIC_RULES_193) },
+    { "rrZ", "রর‍্য", NULL, 0 },
+    { "rry", "রর‍্য", NULL, 0 },
+    { "rZ", "র‍্য", PHONETIC_RULES_196, NELEMS(PHONETIC_RULES_196) },
+    { "ry", "র‍্য", PHONETIC_RULES_197, NELEMS(PHONETIC_RULES_197) },
+    { "rr", "রর", PHONETIC_RULES_198, NELEMS(PHONETIC_RULES_198) },
+    { "Rg", "ড়্গ", NULL, 0 },
+    { "Rh", "ঢ়", NULL, 0 },
+    { "R", "ড়", NULL, 0 },
+    { "r", "র", PHONETIC_RULES_202, NELEMS(PHONETIC_RULES_202) },
+    { "shch", "শ্ছ", NULL, 0 },
+    { "ShTh", "ষ্ঠ", NULL, 0 },
+    { "Shph", "ষ্ফ", NULL, 0 },
+    { "Sch", "শ্ছ", NULL, 0 },
+    { "skl", "স্ক্ল", NULL, 0 },
+    { "skh", "স্খ", NULL, 0 },
+    { "sth", "স্থ", NULL, 0 },
+    { "sph", "স্ফ", NULL, 0 },
+    { "shc", "শ্চ", NULL, 0 },
+    { "sht", "শ্ত", NULL, 0 },
+    { "shn", "শ্ন", NULL, 0 },
+    { "shm", "শ্ম", NULL, 0 },
+    { "shl", "শ্ল", NULL, 0 },
+    { "Shk", "ষ্ক", NULL, 0 },
+    { "ShT", "ষ্ট", NULL, 0 },
+    { "ShN", "ষ্ণ", NULL, 0 },
+    { "Shp", "ষ্প", NULL, 0 },
+    { "Shf", "ষ্ফ", NULL, 0 },
+    { "Shm", "ষ্ম", NULL, 0 },
+    { "spl", "স্প্ল", NULL, 0 },
+    { "sk", "স্ক", NULL, 0 },
+    { "Sc", "শ্চ", NULL, 0 },
+    { "sT", "স্ট", NULL, 0 },
+    { "st", "স্ত", NULL, 0 },
+    { "sn", "স্ন", NULL, 0 },
+    { "sp", "স্প", NULL, 0 },
+    { "sf", "স্ফ", NULL, 0 },
+    { "sm", "স্ম", NULL, 0 },
+    { "sl", "স্ল", NULL, 0 },
+    { "sh", "শ", NULL, 0 },
+    { "Sc", "শ্চ", NULL, 0 },
+    { "St", "শ্ত", NULL, 0 },
+    { "Sn", "শ্ন", NULL, 0 },
+    { "Sm", "শ্ম", NULL, 0 },
+    { "Sl", "শ্ল", NULL, 0 },
+    { "Sh", "ষ", NULL, 0 },
+    { "s", "স", NULL, 0 },
+    { "S", "শ", NULL, 0 },
+    { "oo`", "ু", NULL, 0 },
+    { "oo", "ু", PHONETIC_RULES_242, NELEMS(PHONETIC_RULES_242) },
+    { "o`", "", NULL, 0 },
+    { "oZ", "অ্য", NULL, 0 },
+    { "o", "", PHONETIC_RULES_245, NELEMS(PHONETIC_RULES_245) },
+    { "tth", "ত্থ", NULL, 0 },
+    { "t``", "ৎ", NULL, 0 },
+    { "TT", "ট্ট", NULL, 0 },
+    { "Tm", "ট্ম", NULL, 0 },
+    { "Th", "ঠ", NULL, 0 },
+    { "tn", "ত্ন", NULL, 0 },
+    { "tm", "ত্ম", NULL, 0 },
+    { "th", "থ", NULL, 0 },
+    { "tt", "ত্ত", NULL, 0 },
+    { "T", "ট", NULL, 0 },
+    { "t", "ত", NULL, 0 },
+    { "aZ", "অ্যা", NULL, 0 },
+    { "AZ", "অ্যা", NULL, 0 },
+    { "a`", "া", NULL, 0 },
+    { "A`", "া", NULL, 0 },
+    { "a", "া", PHONETIC_RULES_261, NELEMS(PHONETIC_RULES_261) },
+    { "i`", "ি", NULL, 0 },
+    { "i", "ি", PHONETIC_RULES_263, NELEMS(PHONETIC_RULES_263) },
+    { "I`", "ী", NULL, 0 },
+    { "I", "ী", PHONETIC_RULES_265, NELEMS(PHONETIC_RULES_265) },
+    { "u`", "ু", NULL, 0 },
+    { "u", "ু", PHONETIC_RULES_267, NELEMS(PHONETIC_RULES_267) },
+    { "U`", "ূ", NULL, 0 },
+    { "U", "ূ", PHONETIC_RULES_269, NELEMS(PHONETIC_RULES_269) },
+    { "ee`", "ী", NULL, 0 },
+    { "ee", "ী", PHONETIC_RULES_271, NELEMS(PHONETIC_RULES_271) },
+    { "e`", "ে", NULL, 0 },
+    { "e", "ে", PHONETIC_RULES_273, NELEMS(PHONETIC_RULES_273) },
+    { "z", "য", NULL, 0 },
+    { "Z", "্য", NULL, 0 },
+    { "y", "্য", PHONETIC_RULES_276, NELEMS(PHONETIC_RULES_276) },
+    { "Y", "য়", NULL, 0 },
+    { "q", "ক", NULL, 0 },
+    { "w", "ও", PHONETIC_RULES_279, NELEMS(PHONETIC_RULES_279) },
+    { "x", "ক্স", PHONETIC_RULES_280, NELEMS(PHONETIC_RULES_280) },
+    { ":`", ":", NULL, 0 },
+    { ":", "ঃ", NULL, 0 },
+    { "^`", "^", NULL, 0 },
+    { "^", "ঁ", NULL, 0 },
+    { ",,", "্‌", NULL, 0 },
+    { ",", ",", NULL, 0 },
+    { "$", "৳", NULL, 0 },
+    { "`", "", NULL, 0 },
+};
+
+const PhoneticData AVRO_PHONETIC_DATA = {
+    PHONETIC_PATTERNS,
+    NELEMS(PHONETIC_PATTERNS),
+    "aeiou",
+    "bcdfghjklmnpqrstvwxyz",
+    "oiudgjnrstyz",
+    "",
+};
+
+static const PhoneticMatch REGEX_MATCHES_118_0[] = {
+    { MATCH_TYPE_PREFIX, MATCH_SCOPE_PUNCTUATION, false, "" },
+};
+static const PhoneticRule REGEX_RULES_118[] = {
+    { REGEX_MATCHES_118_0, NELEMS(REGEX_MATCHES_118_0), "([ওোঅ]|(অ্য)|(য়ো?))" },
+};
+
+static const PhoneticPattern REGEX_PATTERNS[] = {
+    { "aa", "(আ|(য়া)|া|((([অএ]্যা?)|[আএ]|([‍‌]?(্য)?া)|(য়া))((([অএ]্যা?)|[আএ]|([‍‌]?(্য)?া)|(য়া)))?))", NULL, 0 },
+    { "au", "(ঔ|ৌ(([অএ]্যা?)|[আএ]|([‍‌]?(্য)?া)|(য়া))([উঊুূ]|(য়[ুূ])))", NULL, 0 },
+    { "az", "((([অএ]্যা?)|[আএ]|([‍‌]?(্য)?া)|(য়া))((জ|য|(জ়)|([‍‌]?্য)))?)", NULL, 0 },
+    { "ai", "(ঐ|ৈ|(([অএ]্যা?)|[আএ]|([‍‌]?(্য)?া)|(য়া))([ইঈিী]|(য়[িী])))", NULL, 0 },
+    { "a", "(([অএ]্যা?)|[অআএ]|([‍‌]?(্য)?া)|(য়া))", NULL, 0 },
+    { "bdh", "((ব(্?)(ধ|ঢ|([দড](্?)(হ|ঃ|(হ্‌?)))))|((ব(্?)[দড])(্?)(হ|ঃ|(হ্‌?)))|(ব(্?)[দড](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "bhl", "(((ভ|(ব(্?)(হ|ঃ|(হ্‌?))))(্?)ল)|(ব(্?)((হ|ঃ|(হ্‌?))(্?)ল))|(ব(্?)(হ|ঃ|(হ্‌?))(্?)ল))", NULL, 0 },
+    { "bh", "(ভ|(ব(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "bb", "(ব(্?)ব?)", NULL, 0 },
+    { "bd", "(ব(্?)[দড])", NULL, 0 },
+    { "bv", "(ব?(্?)ভ)", NULL, 0 },
+    { "b", "ব", NULL, 0 },
+    { "chchh", "((চ্ছ)|((চ|ছ|([চছ](্?)(হ|ঃ|(হ্‌?))))(্?)(((চ|ছ|([চছ](্?)(হ|ঃ|(হ্‌?))))(্?)((হ|ঃ|(হ্‌?)))?)|([চছ](্?)((হ|ঃ|(হ্‌?))(্?)(হ|ঃ|(হ্‌?))))|([চছ](্?)(হ|ঃ|(হ্‌?))(্?)(হ|ঃ|(হ্‌?)))))|((চ|ছ|([চছ](্?)(হ|ঃ|(হ্‌?))))(্?)(চ|ছ|([চছ](্?)(হ|ঃ|(হ্‌?))))(্?)(হ|ঃ|(হ্‌?)))|([চছ](্?)(হ|ঃ|(হ্‌?))(্?)[চছ](্?)(হ|ঃ|(হ্‌?))(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "cch", "(([চছ](্?)(চ|ছ|([চছ](্?)(হ|ঃ|(হ্‌?)))))|([চছ](্?)[চছ](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "chh", "(((চ|ছ|([চছ](্?)(হ|ঃ|(হ্‌?))))(্?)((হ|ঃ|(হ্‌?)))?)|([চছ](্?)((হ|ঃ|(হ্‌?))(্?)(হ|ঃ|(হ্‌?))))|([চছ](্?)(হ|ঃ|(হ্‌?))(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "cng", "((চ্ঞ)|([চছ](্?)(ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ)))))|([চছ](্?)[নণঁঙঞং](্?)(গ|(জ্ঞ)))|(([চছ](্?)[নণঁঙঞং])(্?)(গ|(জ্ঞ))))", NULL, 0 },
+    { "ch", "(চ|ছ|([চছ](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "ck", "(ক|([চছ](্?)ক))", NULL, 0 },
+    { "cc", "([চছ](্?)[চছ]?)", NULL, 0 },
+    { "cn", "([চছ](্?)[নণঁঙঞং])", NULL, 0 },
+    { "c", "[চছ]", NULL, 0 },
+    { "dhm", "((([দড](্?)(গ|(জ্ঞ)))(্?)ম)|([দড](্?)((হ|ঃ|(হ্‌?))(্?)ম))|([দড](্?)(হ|ঃ|(হ্‌?))(্?)ম))", NULL, 0 },
+    { "dhn", "(((ধ|ঢ|([দড](্?)(হ|ঃ|(হ্‌?))))(্?)[নণঁঙঞং])|([দড](্?)((হ|ঃ|(হ্‌?))(্?)[নণঁঙঞং]))|([দড](্?)(হ|ঃ|(হ্‌?))(্?)[নণঁঙঞং]))", NULL, 0 },
+    { "dbh", "(([দড](্?)(ভ|(ব(্?)(হ|ঃ|(হ্‌?)))))|(([দড](্?)ব)(্?)(হ|ঃ|(হ্‌?)))|([দড](্?)ব(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "ddh", "(([দড]?(্?)([দড](্?)(গ|(জ্ঞ))))|(([দড](্?)[দড]?)(্?)(হ|ঃ|(হ্‌?)))|([দড](্?)[দড](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "dgh", "(([দড](্?)(ঘ|((গ|(জ্ঞ))(্?)(হ|ঃ|(হ্‌?)))))|(([দড](্?)(গ|(জ্ঞ)))(্?)(হ|ঃ|(হ্‌?)))|([দড](্?)(গ|(জ্ঞ))(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "db", "([দড](্?)ব)", NULL, 0 },
+    { "dd", "([দড](্?)[দড]?)", NULL, 0 },
+    { "dg", "([দড](্?)(গ|(জ্ঞ)))", NULL, 0 },
+    { "dh", "(ধ|ঢ|([দড](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "d", "[দড]", NULL, 0 },
+    { "ey", "(এ|ই|ে|(েই)|(এই)|ঈ|ী|(((এ্যা?)|[এে]|([‍‌]?(্য)া)|(য়ে))(য়|(ইয়)|([‍‌]?্য))))", NULL, 0 },
+    { "ee", "(ই|ঈ|ি|ী|(য়েই)|(((এ্যা?)|[এে]|([‍‌]?(্য)া)|(য়ে))((এ্যা?)|[এে]|([‍‌]?(্য)া)|(য়ে))))", NULL, 0 },
+    { "e", "((এ্যা?)|[এে]|([‍‌]?(্য)া)|(য়ে))", NULL, 0 },
+    { "ff", "(ফ(্?)ফ?)", NULL, 0 },
+    { "f", "ফ", NULL, 0 },
+    { "ggh", "((((জ্ঞ)|((গ|(জ্ঞ))(্?)((গ|(জ্ঞ)))?))(্?)(হ|ঃ|(হ্‌?)))|((গ|(জ্ঞ))(্?)(ঘ|((গ|(জ্ঞ))(্?)(হ|ঃ|(হ্‌?)))))|((গ|(জ্ঞ))(্?)(গ|(জ্ঞ))(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "gdh", "(((গ|(জ্ঞ))(্?)(ধ|ঢ|([দড](্?)(হ|ঃ|(হ্‌?)))))|((গ|(জ্ঞ))(্?)[দড](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "ghn", "(((ঘ|((গ|(জ্ঞ))(্?)(হ|ঃ|(হ্‌?))))(্?)[নণঁঙঞং])|((গ|(জ্ঞ))(্?)((হ|ঃ|(হ্‌?))(্?)[নণঁঙঞং]))|((গ|(জ্ঞ))(্?)(হ|ঃ|(হ্‌?))(্?)[নণঁঙঞং]))", NULL, 0 },
+    { "gh", "(ঘ|((গ|(জ্ঞ))(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "gg", "((জ্ঞ)|((গ|(জ্ঞ))(্?)((গ|(জ্ঞ)))?))", NULL, 0 },
+    { "g", "(গ|(জ্ঞ))", NULL, 0 },
+    { "hl", "((হ|ঃ|(হ্‌?))(্?)ল)", NULL, 0 },
+    { "hh", "((হ|ঃ|(হ্‌?))(্?)(হ|ঃ|(হ্‌?)))", NULL, 0 },
+    { "hm", "((হ|ঃ|(হ্‌?))(্?)ম)", NULL, 0 },
+    { "hn", "((হ|ঃ|(হ্‌?))(্?)[নণঁঙঞং])", NULL, 0 },
+    { "h", "(হ|ঃ|(হ্‌?))", NULL, 0 },
+    { "ia", "((ঞা)|(([ইঈিী]|(য়[িী]))(([অএ]্যা?)|[আএ]|([‍‌]?(্য)?া)|(য়া))))", NULL, 0 },
+    { "i", "([ইঈিী]|(য়[িী]))", NULL, 0 },
+    { "jng", "((জ্ঞ)|(([জয]|(জ়))(্?)(ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ)))))|(([জয]|(জ়))(্?)[নণঁঙঞং](্?)(গ|(জ্ঞ))))", NULL, 0 },
+    { "jjh", "(((([জয]|(জ়)))?(্?)(ঝ|(([জয]|(জ়))(্?)(হ|ঃ|(হ্‌?)))))|(হ্য)|(((হ্য)|(([জয]|(জ়))(্?)(([জয]|(জ়)))?))(্?)(হ|ঃ|(হ্‌?)))|(([জয]|(জ়))(্?)([জয]|(জ়))(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "jj", "((হ্য)|(([জয]|(জ়))(্?)(([জয]|(জ়)))?))", NULL, 0 },
+    { "jh", "(ঝ|(([জয]|(জ়))(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "j", "([জয]|(জ়))", NULL, 0 },
+    { "kshm", "((((ক(্?)(স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?)))))|((ক(্?)[সশষ])(্?)(হ|ঃ|(হ্‌?)))|(ক(্?)[সশষ](্?)(হ|ঃ|(হ্‌?))))(্?)ম)|(ক(্?)(((স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?))))(্?)ম)|([সশষ](্?)((হ|ঃ|(হ্‌?))(্?)ম))|([সশষ](্?)(হ|ঃ|(হ্‌?))(্?)ম)))|((ক(্?)[সশষ])(্?)((হ|ঃ|(হ্‌?))(্?)ম))|(ক(্?)(স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?))))(্?)ম)|(ক(্?)[সশষ](্?)(হ|ঃ|(হ্‌?))(্?)ম))", NULL, 0 },
+    { "kkhm", "((((ক্ষ)|((ক(্?)ক?)(্?)(হ|ঃ|(হ্‌?)))|(ক?(্?)(খ|(ক্ষ)|(ক(্?)(হ|ঃ|(হ্‌?)))))|(ক(্?)ক(্?)(হ|ঃ|(হ্‌?))))(্?)ম)|((ক(্?)ক?)(্?)((হ|ঃ|(হ্‌?))(্?)ম))|(ক(্?)ক(্?)(হ|ঃ|(হ্‌?))(্?)ম)|(ক(্?)(খ|(ক্ষ)|(ক(্?)(হ|ঃ|(হ্‌?))))(্?)ম))", NULL, 0 },
+    { "kshn", "((((ক(্?)(স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?)))))|((ক(্?)[সশষ])(্?)(হ|ঃ|(হ্‌?)))|(ক(্?)[সশষ](্?)(হ|ঃ|(হ্‌?))))(্?)[নণঁঙঞং])|(ক(্?)(((স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?))))(্?)[নণঁঙঞং])|([সশষ](্?)((হ|ঃ|(হ্‌?))(্?)[নণঁঙঞং]))|([সশষ](্?)(হ|ঃ|(হ্‌?))(্?)[নণঁঙঞং])))|((ক(্?)[সশষ])(্?)((হ|ঃ|(হ্‌?))(্?)[নণঁঙঞং]))|(ক(্?)(স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?))))(্?)[নণঁঙঞং])|(ক(্?)[সশষ](্?)(হ|ঃ|(হ্‌?))(্?)[নণঁঙঞং]))", NULL, 0 },
+    { "kkhn", "((((ক্ষ)|((ক(্?)ক?)(্?)(হ|ঃ|(হ্‌?)))|(ক?(্?)(খ|(ক্ষ)|(ক(্?)(হ|ঃ|(হ্‌?)))))|(ক(্?)ক(্?)(হ|ঃ|(হ্‌?))))(্?)[নণঁঙঞং])|((ক(্?)ক?)(্?)((হ|ঃ|(হ্‌?))(্?)[নণঁঙঞং]))|(ক(্?)ক(্?)(হ|ঃ|(হ্‌?))(্?)[নণঁঙঞং])|(ক(্?)(খ|(ক্ষ)|(ক(্?)(হ|ঃ|(হ্‌?))))(্?)[নণঁঙঞং]))", NULL, 0 },
+    { "ksh", "((ক(্?)(স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?)))))|((ক(্?)[সশষ])(্?)(হ|ঃ|(হ্‌?)))|(ক(্?)[সশষ](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "kkh", "((ক্ষ)|((ক(্?)ক?)(্?)(হ|ঃ|(হ্‌?)))|(ক?(্?)(খ|(ক্ষ)|(ক(্?)(হ|ঃ|(হ্‌?)))))|(ক(্?)ক(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "kxm", "((((ক্ষ)|(ক(্?)((ক্স)|(এক্স)|ষ)))(্?)ম)|(ক(্?)(((ক্স)|(এক্স)|ষ)(্?)ম))|(ক(্?)((ক্স)|(এক্স)|ষ)(্?)ম))", NULL, 0 },
+    { "kxn", "((((ক্ষ)|(ক(্?)((ক্স)|(এক্স)|ষ)))(্?)[নণঁঙঞং])|(ক(্?)(((ক্স)|(এক্স)|ষ)(্?)[নণঁঙঞং]))|(ক(্?)((ক্স)|(এক্স)|ষ)(্?)[নণঁঙঞং]))", NULL, 0 },
+    { "kh", "(খ|(ক্ষ)|(ক(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "kk", "(ক(্?)ক?)", NULL, 0 },
+    { "ks", "(ক(্?)[সশষ])", NULL, 0 },
+    { "kx", "((ক্ষ)|(ক(্?)((ক্স)|(এক্স)|ষ)))", NULL, 0 },
+    { "k", "ক", NULL, 0 },
+    { "lkh", "((ল(্?)(খ|(ক্ষ)|(ক(্?)(হ|ঃ|(হ্‌?)))))|((ল(্?)ক)(্?)(হ|ঃ|(হ্‌?)))|(ল(্?)ক(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "lgh", "((ল(্?)(ঘ|((গ|(জ্ঞ))(্?)(হ|ঃ|(হ্‌?)))))|((ল(্?)(গ|(জ্ঞ)))(্?)(হ|ঃ|(হ্‌?)))|(ল(্?)(গ|(জ্ঞ))(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "lph", "((ল(্?)(ফ|(প(্?)(হ|ঃ|(হ্‌?)))))|((ল(্?)প)(্?)(হ|ঃ|(হ্‌?)))|(ল(্?)প(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "ldh", "((ল(্?)(ধ|ঢ|([দড](্?)(হ|ঃ|(হ্‌?)))))|((ল(্?)[দড])(্?)(হ|ঃ|(হ্‌?)))|(ল(্?)[দড](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "lbh", "((ল(্?)(ভ|(ব(্?)(হ|ঃ|(হ্‌?)))))|((ল(্?)ব)(্?)(হ|ঃ|(হ্‌?)))|(ল(্?)ব(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "ll", "((হ্ল)|(ল?(্?)ল)|(ল(্?)ল))", NULL, 0 },
+    { "lk", "(ল(্?)ক)", NULL, 0 },
+    { "lg", "(ল(্?)(গ|(জ্ঞ)))", NULL, 0 },
+    { "lp", "(ল(্?)প)", NULL, 0 },
+    { "ld", "(ল(্?)[দড])", NULL, 0 },
+    { "lb", "(ল(্?)ব)", NULL, 0 },
+    { "l", "ল", NULL, 0 },
+    { "mbh", "((ম(্?)(ভ|(ব(্?)(হ|ঃ|(হ্‌?)))))|((ম(্?)ব)(্?)(হ|ঃ|(হ্‌?)))|(ম(্?)ব(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "mph", "((ম(্?)(ফ|(প(্?)(হ|ঃ|(হ্‌?)))))|((ম(্?)প)(্?)(হ|ঃ|(হ্‌?)))|(ম(্?)প(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "mth", "((ম(্?)(থ|ঠ|([তটৎ](্?)(হ|ঃ|(হ্‌?)))))|((ম(্?)[তটৎ])(্?)(হ|ঃ|(হ্‌?)))|(ম(্?)[তটৎ](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "mm", "((হ্ম)|(ম(্?)ম?))", NULL, 0 },
+    { "mb", "(ম(্?)ব)", NULL, 0 },
+    { "mp", "(ম(্?)প)", NULL, 0 },
+    { "mt", "(ম(্?)[তটৎ])", NULL, 0 },
+    { "m", "ম", NULL, 0 },
+    { "ngksh", "(((((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)ক)|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)ক))(্?)(স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?)))))|((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)ক(্?)(স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?)))))|((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)((ক(্?)(স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?)))))|((ক(্?)[সশষ])(্?)(হ|ঃ|(হ্‌?)))|(ক(্?)[সশষ](্?)(হ|ঃ|(হ্‌?)))))|((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)(ক(্?)[সশষ])(্?)(হ|ঃ|(হ্‌?)))|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)ক(্?)[সশষ](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "ngkkh", "(((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)((ক্ষ)|((ক(্?)ক?)(্?)(হ|ঃ|(হ্‌?)))|(ক?(্?)(খ|(ক্ষ)|(ক(্?)(হ|ঃ|(হ্‌?)))))|(ক(্?)ক(্?)(হ|ঃ|(হ্‌?)))))|((((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)ক)|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)ক))(্?)(খ|(ক্ষ)|(ক(্?)(হ|ঃ|(হ্‌?)))))|((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)ক(্?)(খ|(ক্ষ)|(ক(্?)(হ|ঃ|(হ্‌?)))))|((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)(ক(্?)ক?)(্?)(হ|ঃ|(হ্‌?)))|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)ক(্?)ক(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "ngch", "(((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)(চ|ছ|([চছ](্?)(হ|ঃ|(হ্‌?)))))|((((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)[চছ])|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)[চছ]))(্?)(হ|ঃ|(হ্‌?)))|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)[চছ](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "nggh", "(((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)(ঘ|((গ|(জ্ঞ))(্?)(হ|ঃ|(হ্‌?)))))|([নণঁঙঞং](্?)((জ্ঞ)|((গ|(জ্ঞ))(্?)((গ|(জ্ঞ)))?))(্?)(হ|ঃ|(হ্‌?)))|([নণঁঙঞং](্?)((((জ্ঞ)|((গ|(জ্ঞ))(্?)((গ|(জ্ঞ)))?))(্?)(হ|ঃ|(হ্‌?)))|((গ|(জ্ঞ))(্?)(ঘ|((গ|(জ্ঞ))(্?)(হ|ঃ|(হ্‌?)))))|((গ|(জ্ঞ))(্?)(গ|(জ্ঞ))(্?)(হ|ঃ|(হ্‌?)))))|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)(গ|(জ্ঞ))(্?)(হ|ঃ|(হ্‌?)))|((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)(গ|(জ্ঞ))(্?)(হ|ঃ|(হ্‌?)))|(((ঙ্গ)|((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)(গ|(জ্ঞ)))|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)(গ|(জ্ঞ))))(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "ngkx", "(((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)((ক্ষ)|(ক(্?)((ক্স)|(এক্স)|ষ))))|((((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)ক)|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)ক))(্?)((ক্স)|(এক্স)|ষ))|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)((ক্ষ)|(ক(্?)((ক্স)|(এক্স)|ষ))))|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)ক(্?)((ক্স)|(এক্স)|ষ)))", NULL, 0 },
+    { "ngjh", "(((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)(ঝ|(([জয]|(জ়))(্?)(হ|ঃ|(হ্‌?)))))|((((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)([জয]|(জ়)))|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)([জয]|(জ়))))(্?)(হ|ঃ|(হ্‌?)))|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)([জয]|(জ়))(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "ngkh", "(((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)(খ|(ক্ষ)|(ক(্?)(হ|ঃ|(হ্‌?)))))|((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)ক(্?)(হ|ঃ|(হ্‌?)))|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)ক(্?)(হ|ঃ|(হ্‌?)))|((((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)ক)|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)ক))(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "nsh", "(([নণঁঙঞং](্?)(স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?)))))|([নণঁঙঞং](্?)[সশষ](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "ndh", "(([নণঁঙঞং](্?)(ধ|ঢ|([দড](্?)(হ|ঃ|(হ্‌?)))))|(([নণঁঙঞং](্?)[দড])(্?)(হ|ঃ|(হ্‌?)))|([নণঁঙঞং](্?)[দড](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "nkh", "(([নণঁঙঞং](্?)(খ|(ক্ষ)|(ক(্?)(হ|ঃ|(হ্‌?)))))|(((ঙ্ক)|([নণঁঙঞং](্?)ক))(্?)(হ|ঃ|(হ্‌?)))|([নণঁঙঞং](্?)ক(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "nth", "(([নণঁঙঞং](্?)(থ|ঠ|([তটৎ](্?)(হ|ঃ|(হ্‌?)))))|(([নণঁঙঞং](্?)[তটৎ])(্?)(হ|ঃ|(হ্‌?)))|([নণঁঙঞং](্?)[তটৎ](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "ngj", "(((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)([জয]|(জ়)))|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)([জয]|(জ়))))", NULL, 0 },
+    { "ngm", "(((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)ম)|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)ম))", NULL, 0 },
+    { "ngg", "((ঙ্গ)|((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)(গ|(জ্ঞ)))|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)(গ|(জ্ঞ))))", NULL, 0 },
+    { "ngx", "(((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)((ক্স)|(এক্স)|ষ))|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)((ক্স)|(এক্স)|ষ)))", NULL, 0 },
+    { "ngk", "(((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)ক)|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)ক))", NULL, 0 },
+    { "ngh", "((ঙ্ঘ)|([নণঁঙঞং](্?)(ঘ|((গ|(জ্ঞ))(্?)(হ|ঃ|(হ্‌?)))))|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "nch", "(([নণঁঙঞং](্?)(চ|ছ|([চছ](্?)(হ|ঃ|(হ্‌?)))))|(((ঞ্চ)|([নণঁঙঞং](্?)[চছ]))(্?)(হ|ঃ|(হ্‌?)))|([নণঁঙঞং](্?)[চছ](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "njh", "(([নণঁঙঞং](্?)(ঝ|(([জয]|(জ়))(্?)(হ|ঃ|(হ্‌?)))))|(((ঞ্জ)|([নণঁঙঞং](্?)([জয]|(জ়))))(্?)(হ|ঃ|(হ্‌?)))|([নণঁঙঞং](্?)([জয]|(জ়))(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "ngc", "(((ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))(্?)[চছ])|([নণঁঙঞং](্?)(গ|(জ্ঞ))(্?)[চছ]))", NULL, 0 },
+    { "nc", "((ঞ্চ)|([নণঁঙঞং](্?)[চছ]))", NULL, 0 },
+    { "nn", "((হ্ণ)|(হ্ন)|([নণঁঙঞং](্?)[নণঁঙঞং]?))", NULL, 0 },
+    { "ng", "(ঙ|ং|ঞ|(ঙ্গ)|([নণঁঙঞং](্?)(গ|(জ্ঞ))))", NULL, 0 },
+    { "nk", "((ঙ্ক)|([নণঁঙঞং](্?)ক))", NULL, 0 },
+    { "nj", "((ঞ্জ)|([নণঁঙঞং](্?)([জয]|(জ়))))", NULL, 0 },
+    { "nd", "([নণঁঙঞং](্?)[দড])", NULL, 0 },
+    { "nt", "([নণঁঙঞং](্?)[তটৎ])", NULL, 0 },
+    { "n", "[নণঁঙঞং]", NULL, 0 },
+    { "oo", "((([উঊুূ]|(য়[ুূ])))|(([ওোঅ]|(অ্য)|(য়ো?))?([ওোঅ]|(অ্য)|(য়ো?))?))", NULL, 0 },
+    { "oi", "(ঐ|ৈ|(([ওোঅ]|(অ্য)|(য়ো?))?([ইঈিী]|(য়[িী]))))", NULL, 0 },
+    { "ou", "(ঔ|ৌ|(([ওোঅ]|(অ্য)|(য়ো?))?([উঊুূ]|(য়[ুূ]))))", NULL, 0 },
+    { "o", "([ওোঅ]|(অ্য)|(য়ো?))?", REGEX_RULES_118, NELEMS(REGEX_RULES_118) },
+    { "phl", "(((ফ|(প(্?)(হ|ঃ|(হ্‌?))))(্?)ল)|(প(্?)((হ|ঃ|(হ্‌?))(্?)ল))|(প(্?)(হ|ঃ|(হ্‌?))(্?)ল))", NULL, 0 },
+    { "ph", "(ফ|(প(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "pp", "(প(্?)প?)", NULL, 0 },
+    { "p", "প", NULL, 0 },
+    { "qq", "(ক(্?)ক?)", NULL, 0 },
+    { "q", "ক", NULL, 0 },
+    { "rri", "(ঋ|ৃ|(([রড়ঢ়]|(হ্র))([রড়ঢ়]|(হ্র))([ইঈিী]|(য়[িী]))))", NULL, 0 },
+    { "ri", "(ঋ|ৃ|(হৃ)|(([রড়ঢ়]|(হ্র))([ইঈিী]|(য়[িী]))))", NULL, 0 },
+    { "rh", "((([রড়ঢ়]|(হ্র)))|(([রড়ঢ়]|(হ্র))(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "r", "([রড়ঢ়]|(হ্র))", NULL, 0 },
+    { "shsh", "((((স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?)))))?(্?)(স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?)))))|([সশষ](্?)(হ|ঃ|(হ্‌?))(্?)[সশষ](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "ssh", "(([সশষ]?(্?)(স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?)))))|([সশষ](্?)[সশষ](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "shm", "(((স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?))))(্?)ম)|([সশষ](্?)((হ|ঃ|(হ্‌?))(্?)ম))|([সশষ](্?)(হ|ঃ|(হ্‌?))(্?)ম))", NULL, 0 },
+    { "shn", "(((স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?))))(্?)[নণঁঙঞং])|([সশষ](্?)((হ|ঃ|(হ্‌?))(্?)[নণঁঙঞং]))|([সশষ](্?)(হ|ঃ|(হ্‌?))(্?)[নণঁঙঞং]))", NULL, 0 },
+    { "ss", "([সশষ](্?)[সশষ]?)", NULL, 0 },
+    { "sh", "(স|শ|ষ|([সশষ](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "s", "[সশষ]", NULL, 0 },
+    { "thth", "((ত্থ)|(((থ|ঠ|([তটৎ](্?)(হ|ঃ|(হ্‌?)))))?(্?)(থ|ঠ|([তটৎ](্?)(হ|ঃ|(হ্‌?)))))|([তটৎ](্?)(হ|ঃ|(হ্‌?))(্?)[তটৎ](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "tth", "(([তটৎ]?(্?)(থ|ঠ|([তটৎ](্?)(হ|ঃ|(হ্‌?)))))|(([তটৎ](্?)[তটৎ]?)(্?)(হ|ঃ|(হ্‌?)))|([তটৎ](্?)[তটৎ](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "t``", "ৎ", NULL, 0 },
+    { "tth", "(([তটৎ]?(্?)(থ|ঠ|([তটৎ](্?)(হ|ঃ|(হ্‌?)))))|(([তটৎ](্?)[তটৎ]?)(্?)(হ|ঃ|(হ্‌?)))|([তটৎ](্?)[তটৎ](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "tt", "([তটৎ](্?)[তটৎ]?)", NULL, 0 },
+    { "th", "(থ|ঠ|([তটৎ](্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "t", "[তটৎ]", NULL, 0 },
+    { "uu", "(ঊ|ূ|(([উঊুূ]|(য়[ুূ]))(([উঊুূ]|(য়[ুূ])))?))", NULL, 0 },
+    { "u", "([উঊুূ]|(য়[ুূ]))", NULL, 0 },
+    { "vv", "(ভ(্?)ভ?)", NULL, 0 },
+    { "v", "ভ", NULL, 0 },
+    { "w", "(ও|(ওয়)|(্ব))", NULL, 0 },
+    { "xm", "(((ক্স)|(এক্স)|ষ)(্?)ম)", NULL, 0 },
+    { "xn", "(((ক্স)|(এক্স)|ষ)(্?)[নণঁঙঞং])", NULL, 0 },
+    { "x", "((ক্স)|(এক্স)|ষ)", NULL, 0 },
+    { "y", "(য়|(ইয়)|([‍‌]?্য))", NULL, 0 },
+    { "zzh", "((হ্য)|((জ|য|(জ়)|([‍‌]?্য))(্?)(ঝ|(([জয]|(জ়))(্?)(হ|ঃ|(হ্‌?)))))|(((হ্য)|((জ|য|(জ়)|([‍‌]?্য))(্?)((জ|য|(জ়)|([‍‌]?্য)))?))(্?)(হ|ঃ|(হ্‌?)))|((জ|য|(জ়)|([‍‌]?্য))(্?)(জ|য|(জ়)|([‍‌]?্য))(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "zh", "(ঝ|(([জয]|(জ়))(্?)(হ|ঃ|(হ্‌?))))", NULL, 0 },
+    { "zz", "((হ্য)|((জ|য|(জ়)|([‍‌]?্য))(্?)((জ|য|(জ়)|([‍‌]?্য)))?))", NULL, 0 },
+    { "z", "(জ|য|(জ়)|([‍‌]?্য))", NULL, 0 },
+    { "0", "(০|(0)|(শূন্য))", NULL, 0 },
+    { "1", "(১|(1)|(এক))", NULL, 0 },
+    { "2", "(২|(2)|(দুই))", NULL, 0 },
+    { "3", "(৩|(3)|(তিন))", NULL, 0 },
+    { "4", "(৪|(4)|(চার))", NULL, 0 },
+    { "5", "(৫|(5)|(পাঁচ))", NULL, 0 },
+    { "6", "((6)|৬|(ছয়))", NULL, 0 },
+    { "7", "(৭|(7)|(সাত))", NULL, 0 },
+    { "8", "(৮|(8)|(আট))", NULL, 0 },
+    { "9", "(৯|(9)|(নয়))", NULL, 0 },
+    { "`", "", NULL, 0 },
+};
+
+const PhoneticData AVRO_REGEX_DATA = {
+    REGEX_PATTERNS,
+    NELEMS(REGEX_PATTERNS),
+    "aeiou",
+    "bcdfghjklmnpqrstvwxyz",
+    "",
+    "|()[]{}^$*+?.~!@#%&-_='\";<>/\\,:`",
+};
+
+} // namespace avro
@@ -0,0 +1,278 @@
+#include <cstring>
+
+#include "phonetic_regex.h"
+#include "utf8.h"
+
+namespace avro {
+
+// AvroRegex escapes its output with "\\u0" + hex for anything past latin1, which only works
+// for three digit code points. ZWJ and ZWNJ come out as U+0200 followed by a "d" or "c", and
+// the avrodict tables were generated with the very same bug, so reproduce it to keep finding
+// those words.
+static void appendAsEscaped(const int codePoint, std::vector<int> *out) {
+    if (codePoint < 0x1000 || codePoint > 0xFFFF) {
+        out->push_back(codePoint);
+        return;
+    }
+    out->push_back(codePoint >> 4);
+    const int lastDigit = codePoint & 0xF;
+    out->push_back(lastDigit < 10 ? '0' + lastDigit : 'a' + lastDigit - 10);
+}
+
+RegexNfa::RegexNfa()
+        : mStates(), mClasses(), mStart(STATE_ACCEPT), mOuts(), mPattern(), mMarks(),
+          mGeneration(0) {
+}
+
+void RegexNfa::clear() {
+    mStates.clear();
+    mClasses.clear();
+    mStart = STATE_ACCEPT;
+    mOuts.clear();
+}
+
+int RegexNfa::addState(const StateType type, const int out, const int out1) {
+    const State state = { type, out, out1, 0, 0 };
+    mStates.push_back(state);
+    return static_cast<int>(mStates.size()) - 1;
+}
+
+int RegexNfa::addCharState(const int classStart, const int classCount) {
+    const int index = addState(STATE_TYPE_CHAR, STATE_ACCEPT, STATE_NONE);
+    mStates[index].classStart = classStart;
+    mStates[index].classCount = classCount;
+    return index;
+}
+
+void RegexNfa::patch(const std::vector<int> &outs, const int target) {
+    for (size_t i = 0; i < outs.size(); ++i) {
+        State *state = &mStates[outs[i] >> 1];
+        if (outs[i] & 1) {
+            state->out1 = target;
+        } else {
+            state->out = target;
+        }
+    }
+}
+
+void RegexNfa::append(const Fragment &fragment) {
+    if (mStart == STATE_ACCEPT) {
+        mStart = fragment.start;
+    } else {
+        patch(mOuts, fragment.start);
+    }
+    mOuts = fragment.outs;
+}
+
+void RegexNfa::appendLiteral(const int codePoint) {
+    mPattern.clear();
+    appendAsEscaped(codePoint, &mPattern);
+    for (size_t i = 0; i < mPattern.size(); ++i) {
+        Fragment fragment;
+        mClasses.push_back(mPattern[i]);
+        fragment.start = addCharState(static_cast<int>(mClasses.size()) - 1, 1);
+        fragment.outs.push_back(fragment.start << 1);
+        append(fragment);
+    }
+}
+
+bool RegexNfa::appendPattern(const char *pattern) {
+    const int length = static_cast<int>(strlen(pattern));
+    mPattern.clear();
+    for (int pos = 0; pos < length;) {
+        appendAsEscaped(decodeUtf8(pattern, length, &pos), &mPattern);
+    }
+    size_t pos = 0;
+    Fragment fragment;
+    if (!parseAlternation(mPattern, &pos, &fragment) || pos != mPattern.size()) {
+        AVRO_LOGE("Unsupported regular expression: %s", pattern);
+        return false;
+    }
+    append(fragment);
+    return true;
+}
+
+bool RegexNfa::parseAlternation(const std::vector<int> &pattern, size_t *pos,
+        Fragment *fragment) {
+    if (!parseConcatenation(pattern, pos, fragment)) {
+        return false;
+    }
+    while (*pos < pattern.size() && pattern[*pos] == '|') {
+        ++*pos;
+        Fragment other;
+        if (!parseConcatenation(pattern, pos, &other)) {
+            return false;
+        }
+        fragment->start = addState(STATE_TYPE_SPLIT, fragment->start, other.start);
+        fragment->outs.insert(fragment->outs.end(), other.outs.begin(), other.outs.end());
+    }
+    return true;
+}
+
+bool RegexNfa::parseConcatenation(const std::vector<int> &pattern, size_t *pos,
+        Fragment *fragment) {
+    bool empty = true;
+    while (*pos < pattern.size() && pattern[*pos] != '|' && pattern[*pos] != ')') {
+        Fragment atom;
+        if (!parseAtom(pattern, pos, &atom)) {
+            return false;
+        }
+        if (*pos < pattern.size() && pattern[*pos] == '?') {
+            ++*pos;
+            const int split = addState(STATE_TYPE_SPLIT, atom.start, STATE_ACCEPT);
+            atom.start = split;
+            atom.outs.push_back(split << 1 | 1);
+        }
+        if (empty) {
+            fragment->start = atom.start;
+            fragment->outs.swap(atom.outs);
+            empty = false;
+        } else {
+            patch(fragment->outs, atom.start);
+            fragment->outs.swap(atom.outs);
+        }
+    }
+    if (empty) {
+        // An empty branch such as the right hand side of "(a|)".
+        fragment->start = addState(STATE_TYPE_SPLIT, STATE_ACCEPT, STATE_NONE);
+        fragment->outs.assign(1, fragment->start << 1);
+    }
+    return true;
+}
+
+bool RegexNfa::parseAtom(const std::vector<int> &pattern, size_t *pos, Fragment *fragment) {
+    const int c = pattern[*pos];
+    ++*pos;
+    if (c == '(') {
+        if (!parseAlternation(pattern, pos, fragment)
+                || *pos >= pattern.size() || pattern[*pos] != ')') {
+            return false;
+        }
+        ++*pos;
+        return true;
+    }
+    const int classStart = static_cast<int>(mClasses.size());
+    if (c == '[') {
+        while (*pos < pattern.size() && pattern[*pos] != ']') {
+            mClasses.push_back(pattern[*pos]);
+            ++*pos;
+        }
+        if (*pos >= pattern.size()) {
+            return false;
+        }
+        ++*pos;
+    } else if (c == ')' || c == '|' || c == '?' || c == ']') {
+        return false;
+    } else {
+        mClasses.push_back(c);
+    }
+    fragment->start = addCharState(classStart, static_cast<int>(mClasses.size()) - classStart);
+    fragment->outs.assign(1, fragment->start << 1);
+    return true;
+}
+
+void RegexNfa::addToSet(const int state, NfaStateSet *states) const {
+    if (state == STATE_ACCEPT) {
+        states->accepting = true;
+        return;
+    }
+    if (state == STATE_NONE || mMarks[state] == mGeneration) {
+        return;
+    }
+    mMarks[state] = mGeneration;
+    const State &s = mStates[state];
+    if (s.type == STATE_TYPE_SPLIT) {
+        addToSet(s.out, states);
+        addToSet(s.out1, states);
+    } else {
+        states->states.push_back(state);
+    }
+}
+
+bool RegexNfa::classContains(const State &state, const int codePoint) const {
+    for (int i = 0; i < state.classCount; ++i) {
+        if (mClasses[state.classStart + i] == codePoint) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void RegexNfa::start(NfaStateSet *states) const {
+    states->clear();
+    mMarks.resize(mStates.size(), 0);
+    ++mGeneration;
+    addToSet(mStart, states);
+}
+
+void RegexNfa::step(const NfaStateSet &from, const int codePoint, NfaStateSet *to) const {
+    to->clear();
+    mMarks.resize(mStates.size(), 0);
+    ++mGeneration;
+    for (size_t i = 0; i < from.states.size(); ++i) {
+        const State &state = mStates[from.states[i]];
+        if (classContains(state, codePoint)) {
+            addToSet(state.out, to);
+        }
+    }
+}
+
+const char *const PhoneticRegex::PATTERN_SUFFIX = "(্[যবম])?(্?)([ঃঁ]?)";
+
+void PhoneticRegex::parse(const std::string &input, std::string *output) const {
+    std::string text;
+    mParser.fixString(input, &text);
+    output->clear();
+    const int length = static_cast<int>(text.size());
+    for (int pos = 0; pos < length;) {
+        int end = 0;
+        const char *replace = mParser.matchAt(text, pos, &end);
+        if (replace) {
+            output->append(replace);
+            output->append(PATTERN_SUFFIX);
+            pos = end;
+        } else {
+            output->push_back(text[pos]);
+            ++pos;
+        }
+    }
+}
+
+void PhoneticRegex::compile(const std::string &input, RegexNfa *nfa) const {
+    std::vector<RegexSegment> segments;
+    getSegments(input, &segments);
+    nfa->clear();
+    for (size_t i = 0; i < segments.size(); ++i) {
+        appendSegment(segments[i], nfa);
+    }
+}
+
+void PhoneticRegex::getSegments(const std::string &input,
+        std::vector<RegexSegment> *segments) const {
+    std::string text;
+    mParser.fixString(input, &text);
+    segments->clear();
+    const int length = static_cast<int>(text.size());
+    for (int pos = 0; pos < length;) {
+        int end = 0;
+        RegexSegment segment = { mParser.matchAt(text, pos, &end), 0 };
+        if (segment.pattern) {
+            pos = end;
+        } else {
+            // Patterns are ascii only, so take the whole code point rather than a single byte.
+            segment.codePoint = decodeUtf8(text.data(), length, &pos);
+        }
+        segments->push_back(segment);
+    }
+}
+
+void PhoneticRegex::appendSegment(const RegexSegment &segment, RegexNfa *nfa) const {
+    if (segment.pattern) {
+        nfa->appendPattern(segment.pattern);
+        nfa->appendPattern(PATTERN_SUFFIX);
+    } else {
+        nfa->appendLiteral(segment.codePoint);
+    }
+}
+
+} // namespace avro
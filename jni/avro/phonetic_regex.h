@@ -0,0 +1,127 @@
+#ifndef AVRO_PHONETIC_REGEX_H
+#define AVRO_PHONETIC_REGEX_H
+
+#include <string>
+#include <vector>
+
+#include "defines.h"
+#include "phonetic.h"
+
+namespace avro {
+
+// A set of live NFA states. |accepting| is set when the end of the expression is reachable.
+struct NfaStateSet {
+    NfaStateSet() : states(), accepting(false) {}
+
+    void clear() {
+        states.clear();
+        accepting = false;
+    }
+
+    bool isDead() const {
+        return states.empty() && !accepting;
+    }
+
+    std::vector<int> states;
+    bool accepting;
+};
+
+// Thompson NFA for the small regular expression dialect the avroregexlib tables are written
+// in: literals, [classes], (groups), "|" and "?". Expressions are appended one after another
+// and the NFA is always anchored at both ends, as dbsearch wraps them in "^...$".
+class RegexNfa {
+ public:
+    RegexNfa();
+
+    void clear();
+    bool appendPattern(const char *pattern);
+    void appendLiteral(const int codePoint);
+
+    void start(NfaStateSet *states) const;
+    void step(const NfaStateSet &from, const int codePoint, NfaStateSet *to) const;
+
+ private:
+    DISALLOW_COPY_AND_ASSIGN(RegexNfa);
+
+    // Out edges that still lead nowhere point at STATE_ACCEPT until the next expression is
+    // appended and they get patched to its start.
+    static const int STATE_ACCEPT = -1;
+    static const int STATE_NONE = -2;
+
+    typedef enum {
+        STATE_TYPE_CHAR,
+        STATE_TYPE_SPLIT,
+    } StateType;
+
+    struct State {
+        StateType type;
+        int out;
+        int out1;
+        int classStart;
+        int classCount;
+    };
+
+    // Dangling out edges are encoded as (state << 1 | edge).
+    struct Fragment {
+        Fragment() : start(STATE_ACCEPT), outs() {}
+        int start;
+        std::vector<int> outs;
+    };
+
+    int addState(const StateType type, const int out, const int out1);
+    int addCharState(const int classStart, const int classCount);
+    void patch(const std::vector<int> &outs, const int target);
+    void append(const Fragment &fragment);
+
+    bool parseAlternation(const std::vector<int> &pattern, size_t *pos, Fragment *fragment);
+    bool parseConcatenation(const std::vector<int> &pattern, size_t *pos, Fragment *fragment);
+    bool parseAtom(const std::vector<int> &pattern, size_t *pos, Fragment *fragment);
+
+    void addToSet(const int state, NfaStateSet *states) const;
+    bool classContains(const State &state, const int codePoint) const;
+
+    std::vector<State> mStates;
+    std::vector<int> mClasses;
+    int mStart;
+    std::vector<int> mOuts;
+    std::vector<int> mPattern;
+    mutable std::vector<unsigned int> mMarks;
+    mutable unsigned int mGeneration;
+};
+
+// One piece of the expression for an input: the replacement of a matched pattern, or a code
+// point that matched nothing and stands for itself.
+struct RegexSegment {
+    bool operator==(const RegexSegment &other) const {
+        return pattern == other.pattern && codePoint == other.codePoint;
+    }
+
+    const char *pattern;
+    int codePoint;
+};
+
+// Native port of avroregexlib's AvroRegex.parse(), which turns roman input into a regular
+// expression matching all its possible Bengali spellings.
+class PhoneticRegex {
+ public:
+    PhoneticRegex() : mParser(&AVRO_REGEX_DATA) {}
+
+    // The expression source as the js builds it, minus its \u escaping.
+    void parse(const std::string &input, std::string *output) const;
+    // Builds the expression for |input| straight into |nfa|.
+    void compile(const std::string &input, RegexNfa *nfa) const;
+    // The expression for |input| is the concatenation of these, in order.
+    void getSegments(const std::string &input, std::vector<RegexSegment> *segments) const;
+    void appendSegment(const RegexSegment &segment, RegexNfa *nfa) const;
+
+ private:
+    DISALLOW_COPY_AND_ASSIGN(PhoneticRegex);
+
+    // Appended after every matched pattern to allow for jofola, hasanta, bisarga and candrabindu.
+    static const char *const PATTERN_SUFFIX;
+
+    const PhoneticParser mParser;
+};
+
+} // namespace avro
+#endif // AVRO_PHONETIC_REGEX_H
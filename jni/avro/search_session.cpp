@@ -0,0 +1,207 @@
+#include <algorithm>
+
+#include "binary_format.h"
+#include "search_session.h"
+#include "utf8.h"
+
+namespace avro {
+
+SearchSession::SearchSession(Dictionary *dictionary)
+        : mDictionary(dictionary), mRegex(), mNfa(), mInitial('\0'), mRoots(), mNewRoots(),
+          mSegments(), mNewSegments(), mFrontiers(), mTarget(NULL), mStateSets(), mWord(),
+          mMatches() {
+}
+
+void SearchSession::reset() {
+    mInitial = '\0';
+    mRoots.clear();
+    mSegments.clear();
+}
+
+void SearchSession::search(const std::string &input, std::vector<std::string> *results) {
+    results->clear();
+    if (input.empty()) {
+        return;
+    }
+    mDictionary->getSearchTables(input[0], &mNewRoots);
+    if (mNewRoots.empty()) {
+        return;
+    }
+    if (input[0] != mInitial || mNewRoots != mRoots) {
+        reset();
+        mInitial = input[0];
+        mRoots.swap(mNewRoots);
+        if (mFrontiers.empty()) {
+            mFrontiers.resize(1);
+        }
+        Frontier *roots = &mFrontiers[0];
+        roots->clear();
+        for (size_t i = 0; i < mRoots.size(); ++i) {
+            const TrieLocation location = { static_cast<int>(i), true, 0, 0, 0, 0 };
+            roots->locations.push_back(location);
+        }
+    }
+
+    // Keep the frontiers of the segments the input still starts with, walk the rest.
+    mRegex.getSegments(input, &mNewSegments);
+    size_t shared = 0;
+    while (shared < mSegments.size() && shared < mNewSegments.size()
+            && mSegments[shared] == mNewSegments[shared]) {
+        ++shared;
+    }
+    mSegments.swap(mNewSegments);
+    if (mFrontiers.size() < mSegments.size() + 1) {
+        mFrontiers.resize(mSegments.size() + 1);
+    }
+    for (size_t i = shared; i < mSegments.size(); ++i) {
+        mNfa.clear();
+        mRegex.appendSegment(mSegments[i], &mNfa);
+        advance(mFrontiers[i], &mFrontiers[i + 1]);
+    }
+
+    // Words end exactly where the last segment left off.
+    const Frontier &last = mFrontiers[mSegments.size()];
+    mMatches.clear();
+    for (size_t i = 0; i < last.locations.size(); ++i) {
+        Match match = { last.locations[i].table, 0, static_cast<int>(i) };
+        if (getWordIndex(last.locations[i], &match.wordIndex)) {
+            mMatches.push_back(match);
+        }
+    }
+    // The js goes through the tables in turn and scans each front to back.
+    std::sort(mMatches.begin(), mMatches.end());
+    for (size_t i = 0; i < mMatches.size(); ++i) {
+        const TrieLocation &location = last.locations[mMatches[i].location];
+        results->push_back(std::string());
+        for (int j = 0; j < location.wordLength; ++j) {
+            appendUtf8(last.codePoints[location.wordStart + j], &results->back());
+        }
+    }
+}
+
+// Runs the NFA of a single segment from every location of |from|, and collects the locations
+// where it accepts into |to|.
+void SearchSession::advance(const Frontier &from, Frontier *to) {
+    to->clear();
+    mTarget = to;
+    for (size_t i = 0; i < from.locations.size(); ++i) {
+        const TrieLocation &location = from.locations[i];
+        const int depth = location.wordLength;
+        if (static_cast<int>(mStateSets.size()) <= depth) {
+            mStateSets.resize(depth + 1);
+        }
+        if (static_cast<int>(mWord.size()) < depth) {
+            mWord.resize(depth);
+        }
+        std::copy(from.codePoints.begin() + location.wordStart,
+                from.codePoints.begin() + location.wordStart + depth, mWord.begin());
+        mNfa.start(&mStateSets[depth]);
+        if (mStateSets[depth].accepting) {
+            // The segment can match nothing at all.
+            addLocation(location.table, location.isRoot, location.flags, location.pos, depth);
+        }
+        if (mStateSets[depth].states.empty()) {
+            continue;
+        }
+        if (location.isRoot) {
+            walkGroups(location.table, location.pos, depth);
+        } else {
+            walkChars(location.table, location.flags, location.pos, depth);
+        }
+    }
+    mTarget = NULL;
+    // The same place can be reached from several locations of |from|.
+    std::vector<TrieLocation> &locations = to->locations;
+    std::sort(locations.begin(), locations.end());
+    locations.erase(std::unique(locations.begin(), locations.end()), locations.end());
+}
+
+void SearchSession::walkGroups(const int table, int pos, const int depth) {
+    const uint8_t *const root = mRoots[table];
+    const int groupCount = BinaryFormat::getGroupCountAndForwardPointer(root, &pos);
+    for (int i = 0; i < groupCount; ++i) {
+        const uint8_t flags = BinaryFormat::getFlagsAndForwardPointer(root, &pos);
+        const int codePoint = BinaryFormat::getCodePointAndForwardPointer(root, &pos);
+        if (step(table, flags, pos, codePoint, depth)) {
+            walkChars(table, flags, pos, depth + 1);
+        }
+        if (flags & BinaryFormat::FLAG_HAS_MULTIPLE_CHARS) {
+            pos = BinaryFormat::skipOtherCharacters(root, pos);
+        }
+        if (flags & BinaryFormat::FLAG_IS_TERMINAL) {
+            BinaryFormat::getWordIndexAndForwardPointer(root, flags, &pos);
+        }
+        pos = BinaryFormat::skipChildrenPosition(flags, pos);
+    }
+}
+
+// Follows the char group from the location at |pos| on, and then its children.
+void SearchSession::walkChars(const int table, const uint8_t flags, int pos, const int depth) {
+    const uint8_t *const root = mRoots[table];
+    int length = depth;
+    if (flags & BinaryFormat::FLAG_HAS_MULTIPLE_CHARS) {
+        for (;;) {
+            const int codePoint = BinaryFormat::getCodePointAndForwardPointer(root, &pos);
+            if (codePoint == BinaryFormat::NOT_A_CODE_POINT) {
+                break;
+            }
+            if (!step(table, flags, pos, codePoint, length)) {
+                return;
+            }
+            ++length;
+        }
+    }
+    if (!BinaryFormat::hasChildrenInFlags(flags)) {
+        return;
+    }
+    if (flags & BinaryFormat::FLAG_IS_TERMINAL) {
+        BinaryFormat::getWordIndexAndForwardPointer(root, flags, &pos);
+    }
+    walkGroups(table, BinaryFormat::readChildrenPosition(root, flags, pos), length);
+}
+
+// Feeds |codePoint| to the NFA after the |depth| code points in |mWord|. Returns whether the
+// walk should go on.
+bool SearchSession::step(const int table, const uint8_t flags, const int pos,
+        const int codePoint, const int depth) {
+    if (static_cast<int>(mStateSets.size()) <= depth + 1) {
+        mStateSets.resize(depth + 2);
+    }
+    if (static_cast<int>(mWord.size()) <= depth) {
+        mWord.resize(depth + 1);
+    }
+    mNfa.step(mStateSets[depth], codePoint, &mStateSets[depth + 1]);
+    mWord[depth] = codePoint;
+    if (mStateSets[depth + 1].accepting) {
+        addLocation(table, false, flags, pos, depth + 1);
+    }
+    return !mStateSets[depth + 1].states.empty();
+}
+
+void SearchSession::addLocation(const int table, const bool isRoot, const uint8_t flags,
+        const int pos, const int depth) {
+    const TrieLocation location = {
+        table, isRoot, flags, pos, static_cast<int>(mTarget->codePoints.size()), depth
+    };
+    mTarget->locations.push_back(location);
+    mTarget->codePoints.insert(mTarget->codePoints.end(), mWord.begin(), mWord.begin() + depth);
+}
+
+// Whether a word ends at |location|, and if so its index.
+bool SearchSession::getWordIndex(const TrieLocation &location, int *wordIndex) const {
+    if (location.isRoot || !(location.flags & BinaryFormat::FLAG_IS_TERMINAL)) {
+        return false;
+    }
+    const uint8_t *const root = mRoots[location.table];
+    int pos = location.pos;
+    if (location.flags & BinaryFormat::FLAG_HAS_MULTIPLE_CHARS) {
+        if (root[pos] != BinaryFormat::CHARACTER_ARRAY_TERMINATOR) {
+            return false;
+        }
+        ++pos;
+    }
+    *wordIndex = BinaryFormat::getWordIndexAndForwardPointer(root, location.flags, &pos);
+    return true;
+}
+
+} // namespace avro
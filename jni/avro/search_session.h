@@ -0,0 +1,111 @@
+#ifndef AVRO_SEARCH_SESSION_H
+#define AVRO_SEARCH_SESSION_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "defines.h"
+#include "dictionary.h"
+#include "phonetic_regex.h"
+
+namespace avro {
+
+// Dictionary search that carries its state from one keystroke to the next, like LatinIME's
+// DicTraverseSession does for continuous suggestions.
+//
+// The expression for an input is a chain of segments, one per matched pattern. After each
+// segment the session keeps its frontier: every place in the tries where the words matching
+// the segments so far end. The frontier after segment n + 1 only depends on the frontier
+// after segment n and on segment n + 1 itself, so when the next input shares its first
+// segments with the previous one, as it does after typing or deleting a letter, the walk picks
+// up from the last frontier they share instead of starting over from the roots.
+class SearchSession {
+ public:
+    explicit SearchSession(Dictionary *dictionary);
+
+    // Same results, in the same order, as Dictionary::search().
+    void search(const std::string &input, std::vector<std::string> *results);
+    // Forgets the frontiers, needed whenever the dictionary gets opened again.
+    void reset();
+
+ private:
+    DISALLOW_IMPLICIT_CONSTRUCTORS(SearchSession);
+
+    // Where a walk can pick up again: right after a code point of a char group, or in front of
+    // the root group of a table. |pos| is relative to the table root and points at what
+    // follows the code point: the next code point of the group (or its terminator) if it has
+    // several, its word index or children position otherwise.
+    struct TrieLocation {
+        bool operator<(const TrieLocation &other) const {
+            if (table != other.table) return table < other.table;
+            if (isRoot != other.isRoot) return isRoot;
+            return pos < other.pos;
+        }
+
+        bool operator==(const TrieLocation &other) const {
+            return table == other.table && isRoot == other.isRoot && pos == other.pos;
+        }
+
+        int table;
+        bool isRoot;
+        uint8_t flags;
+        int pos;
+        // The word so far, kept in the code points of its frontier.
+        int wordStart;
+        int wordLength;
+    };
+
+    struct Frontier {
+        Frontier() : locations(), codePoints() {}
+
+        void clear() {
+            locations.clear();
+            codePoints.clear();
+        }
+
+        std::vector<TrieLocation> locations;
+        std::vector<int> codePoints;
+    };
+
+    // A word that matched, and its index in its js table.
+    struct Match {
+        bool operator<(const Match &other) const {
+            if (table != other.table) return table < other.table;
+            return wordIndex < other.wordIndex;
+        }
+
+        int table;
+        int wordIndex;
+        int location;
+    };
+
+    void advance(const Frontier &from, Frontier *to);
+    void walkGroups(const int table, int pos, const int depth);
+    void walkChars(const int table, const uint8_t flags, int pos, const int depth);
+    bool step(const int table, const uint8_t flags, const int pos, const int codePoint,
+            const int depth);
+    void addLocation(const int table, const bool isRoot, const uint8_t flags, const int pos,
+            const int depth);
+    bool getWordIndex(const TrieLocation &location, int *wordIndex) const;
+
+    Dictionary *const mDictionary;
+    const PhoneticRegex mRegex;
+    RegexNfa mNfa;
+    char mInitial;
+    std::vector<const uint8_t *> mRoots;
+    std::vector<const uint8_t *> mNewRoots;
+    std::vector<RegexSegment> mSegments;
+    std::vector<RegexSegment> mNewSegments;
+    // mFrontiers[n] is the frontier after the first n segments, only the first
+    // mSegments.size() + 1 are current, the rest are kept for their memory.
+    std::vector<Frontier> mFrontiers;
+    // The frontier being filled by the walk.
+    Frontier *mTarget;
+    std::vector<NfaStateSet> mStateSets;
+    std::vector<int> mWord;
+    std::vector<Match> mMatches;
+};
+
+} // namespace avro
+#endif // AVRO_SEARCH_SESSION_H
@@ -0,0 +1,399 @@
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "selection_store.h"
+
+namespace avro {
+
+static int readInt(const uint8_t *const data, const int pos, const int size) {
+    int value = 0;
+    for (int i = 0; i < size; ++i) {
+        value = (value << 8) | data[pos + i];
+    }
+    return value;
+}
+
+static void appendInt(const unsigned int value, const int size, std::string *out) {
+    for (int i = size - 1; i >= 0; --i) {
+        out->push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+    }
+}
+
+SelectionStore::SelectionStore()
+        : mPath(), mTableAddr(NULL), mTableSize(0), mSlotCount(0), mLogEntries(),
+          mOldLogEntries(), mLogFd(-1), mLogRecordCount(0), mHasOldLog(false), mCanCompact(false),
+          mCompactionThread(), mMutex(), mCompactionState(COMPACTION_IDLE) {
+    pthread_mutex_init(&mMutex, NULL);
+}
+
+SelectionStore::~SelectionStore() {
+    close();
+    pthread_mutex_destroy(&mMutex);
+}
+
+bool SelectionStore::open(const char *path) {
+    close();
+    mPath = path;
+    mapTable();
+    int recordCount = 0;
+    long validLength = 0;
+    mHasOldLog = readLog(mPath + ".log.old", &mOldLogEntries, &recordCount, &validLength);
+    const std::string logPath = mPath + ".log";
+    readLog(logPath, &mLogEntries, &mLogRecordCount, &validLength);
+    mLogFd = ::open(logPath.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0600);
+    if (mLogFd < 0) {
+        AVRO_LOGE("Can't open %s: %d", logPath.c_str(), errno);
+        close();
+        return false;
+    }
+    // Drop whatever half written record a crash may have left at the end.
+    if (ftruncate(mLogFd, validLength) != 0) {
+        AVRO_LOGE("Can't truncate %s: %d", logPath.c_str(), errno);
+    }
+    mCanCompact = true;
+    if (mHasOldLog) {
+        // A compaction got interrupted, finish it.
+        startCompaction();
+    }
+    return true;
+}
+
+void SelectionStore::close() {
+    pthread_mutex_lock(&mMutex);
+    const bool isCompacting = mCompactionState != COMPACTION_IDLE;
+    pthread_mutex_unlock(&mMutex);
+    if (isCompacting) {
+        pthread_join(mCompactionThread, NULL);
+        mCompactionState = COMPACTION_IDLE;
+    }
+    unmapTable();
+    if (mLogFd >= 0) {
+        ::close(mLogFd);
+    }
+    mLogFd = -1;
+    mLogRecordCount = 0;
+    mLogEntries.clear();
+    mOldLogEntries.clear();
+    mHasOldLog = false;
+    mCanCompact = false;
+    mPath.clear();
+}
+
+bool SelectionStore::find(const std::string &key, std::string *value) {
+    finishCompaction();
+    EntryMap::const_iterator it = mLogEntries.find(key);
+    if (it != mLogEntries.end()) {
+        *value = it->second;
+        return true;
+    }
+    it = mOldLogEntries.find(key);
+    if (it != mOldLogEntries.end()) {
+        *value = it->second;
+        return true;
+    }
+    return findInTable(key, value);
+}
+
+void SelectionStore::put(const std::string &key, const std::string &value) {
+    if (key.size() > MAX_STRING_LENGTH || value.size() > MAX_STRING_LENGTH) {
+        return;
+    }
+    std::string current;
+    if (find(key, &current) && current == value) {
+        return;
+    }
+    mLogEntries[key] = value;
+    if (mLogFd < 0) {
+        return;
+    }
+    std::string record;
+    appendRecord(key, value, &record);
+    if (!writeFully(mLogFd, record)) {
+        AVRO_LOGE("Can't write to %s.log: %d", mPath.c_str(), errno);
+        return;
+    }
+    ++mLogRecordCount;
+    if (mLogRecordCount >= COMPACTION_THRESHOLD && !mHasOldLog && mCanCompact) {
+        // Set the log aside for the compaction and carry on with a fresh one.
+        const std::string logPath = mPath + ".log";
+        const std::string oldLogPath = logPath + ".old";
+        ::close(mLogFd);
+        mLogFd = -1;
+        if (rename(logPath.c_str(), oldLogPath.c_str()) != 0) {
+            AVRO_LOGE("Can't rename %s: %d", logPath.c_str(), errno);
+            mCanCompact = false;
+        } else {
+            mOldLogEntries.swap(mLogEntries);
+            mLogEntries.clear();
+            mLogRecordCount = 0;
+            mHasOldLog = true;
+        }
+        mLogFd = ::open(logPath.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0600);
+        if (mLogFd < 0) {
+            AVRO_LOGE("Can't open %s: %d", logPath.c_str(), errno);
+        }
+        if (mHasOldLog) {
+            startCompaction();
+        }
+    }
+}
+
+void SelectionStore::startCompaction() {
+    pthread_mutex_lock(&mMutex);
+    mCompactionState = COMPACTION_RUNNING;
+    pthread_mutex_unlock(&mMutex);
+    if (pthread_create(&mCompactionThread, NULL, runCompaction, this) != 0) {
+        AVRO_LOGE("Can't start the compaction of %s", mPath.c_str());
+        mCompactionState = COMPACTION_IDLE;
+        mCanCompact = false;
+    }
+}
+
+// Takes on the new table once the compaction thread is done with it.
+void SelectionStore::finishCompaction() {
+    pthread_mutex_lock(&mMutex);
+    const CompactionState state = mCompactionState;
+    pthread_mutex_unlock(&mMutex);
+    if (state != COMPACTION_SUCCEEDED && state != COMPACTION_FAILED) {
+        return;
+    }
+    pthread_join(mCompactionThread, NULL);
+    mCompactionState = COMPACTION_IDLE;
+    if (state == COMPACTION_FAILED) {
+        // The old log stays around and gets another go on the next open.
+        mCanCompact = false;
+        return;
+    }
+    unmapTable();
+    mapTable();
+    mOldLogEntries.clear();
+    mHasOldLog = false;
+}
+
+void *SelectionStore::runCompaction(void *store) {
+    SelectionStore *const self = static_cast<SelectionStore *>(store);
+    const bool succeeded = self->compact();
+    pthread_mutex_lock(&self->mMutex);
+    self->mCompactionState = succeeded ? COMPACTION_SUCCEEDED : COMPACTION_FAILED;
+    pthread_mutex_unlock(&self->mMutex);
+    return NULL;
+}
+
+// Writes the table merged with the old log to <path>.tmp, and moves it over the table.
+bool SelectionStore::compact() const {
+    std::vector<std::pair<std::string, std::string> > entries;
+    const uint8_t *const table = static_cast<const uint8_t *>(mTableAddr);
+    std::string key;
+    std::string value;
+    for (int i = 0; i < mSlotCount; ++i) {
+        const int offset = readInt(table, HEADER_SIZE + i * SLOT_SIZE, SLOT_SIZE);
+        if (offset != 0 && readRecord(offset, &key, &value)
+                && mOldLogEntries.find(key) == mOldLogEntries.end()) {
+            entries.push_back(std::make_pair(key, value));
+        }
+    }
+    entries.insert(entries.end(), mOldLogEntries.begin(), mOldLogEntries.end());
+
+    int slotCount = 16;
+    while (slotCount < static_cast<int>(entries.size()) * 2) {
+        slotCount *= 2;
+    }
+    std::vector<unsigned int> slots(slotCount, 0);
+    std::string records;
+    const int recordsStart = HEADER_SIZE + slotCount * SLOT_SIZE;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const std::string &entryKey = entries[i].first;
+        unsigned int slot = getHash(entryKey.data(), static_cast<int>(entryKey.size()))
+                & (slotCount - 1);
+        while (slots[slot] != 0) {
+            slot = (slot + 1) & (slotCount - 1);
+        }
+        slots[slot] = recordsStart + records.size();
+        appendRecord(entryKey, entries[i].second, &records);
+    }
+    std::string data;
+    data.reserve(recordsStart + records.size());
+    appendInt(MAGIC_NUMBER, 4, &data);
+    appendInt(FORMAT_VERSION, 2, &data);
+    appendInt(0, 2, &data);
+    appendInt(slotCount, 4, &data);
+    appendInt(static_cast<unsigned int>(entries.size()), 4, &data);
+    for (int i = 0; i < slotCount; ++i) {
+        appendInt(slots[i], SLOT_SIZE, &data);
+    }
+    data.append(records);
+
+    const std::string tmpPath = mPath + ".tmp";
+    const int fd = ::open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0) {
+        AVRO_LOGE("Can't open %s: %d", tmpPath.c_str(), errno);
+        return false;
+    }
+    const bool written = writeFully(fd, data) && fsync(fd) == 0;
+    ::close(fd);
+    if (!written || rename(tmpPath.c_str(), mPath.c_str()) != 0) {
+        AVRO_LOGE("Can't write %s: %d", mPath.c_str(), errno);
+        unlink(tmpPath.c_str());
+        return false;
+    }
+    unlink((mPath + ".log.old").c_str());
+    return true;
+}
+
+bool SelectionStore::mapTable() {
+    const int fd = ::open(mPath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < HEADER_SIZE) {
+        AVRO_LOGE("%s is not a selection table", mPath.c_str());
+        ::close(fd);
+        return false;
+    }
+    void *const addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        AVRO_LOGE("Can't mmap %s: %d", mPath.c_str(), errno);
+        return false;
+    }
+    const uint8_t *const table = static_cast<const uint8_t *>(addr);
+    const int slotCount = readInt(table, 8, 4);
+    if (readInt(table, 0, 4) != MAGIC_NUMBER || readInt(table, 4, 2) != FORMAT_VERSION
+            || slotCount <= 0 || (slotCount & (slotCount - 1)) != 0
+            || slotCount > (st.st_size - HEADER_SIZE) / SLOT_SIZE) {
+        AVRO_LOGE("%s is not a selection table", mPath.c_str());
+        munmap(addr, st.st_size);
+        return false;
+    }
+    mTableAddr = addr;
+    mTableSize = st.st_size;
+    mSlotCount = slotCount;
+    return true;
+}
+
+void SelectionStore::unmapTable() {
+    if (mTableAddr) {
+        munmap(mTableAddr, mTableSize);
+    }
+    mTableAddr = NULL;
+    mTableSize = 0;
+    mSlotCount = 0;
+}
+
+bool SelectionStore::readRecord(const int offset, std::string *key, std::string *value) const {
+    const uint8_t *const table = static_cast<const uint8_t *>(mTableAddr);
+    const int size = static_cast<int>(mTableSize);
+    if (offset < HEADER_SIZE || offset > size - 2) {
+        return false;
+    }
+    const int keyLength = readInt(table, offset, 2);
+    const int valuePos = offset + 2 + keyLength;
+    if (valuePos > size - 2) {
+        return false;
+    }
+    const int valueLength = readInt(table, valuePos, 2);
+    if (valuePos + 2 + valueLength > size) {
+        return false;
+    }
+    key->assign(reinterpret_cast<const char *>(table + offset + 2), keyLength);
+    value->assign(reinterpret_cast<const char *>(table + valuePos + 2), valueLength);
+    return true;
+}
+
+bool SelectionStore::findInTable(const std::string &key, std::string *value) const {
+    if (!mTableAddr) {
+        return false;
+    }
+    const uint8_t *const table = static_cast<const uint8_t *>(mTableAddr);
+    unsigned int slot = getHash(key.data(), static_cast<int>(key.size())) & (mSlotCount - 1);
+    std::string slotKey;
+    for (int i = 0; i < mSlotCount; ++i) {
+        const int offset = readInt(table, HEADER_SIZE + slot * SLOT_SIZE, SLOT_SIZE);
+        if (offset == 0 || !readRecord(offset, &slotKey, value)) {
+            return false;
+        }
+        if (slotKey == key) {
+            return true;
+        }
+        slot = (slot + 1) & (mSlotCount - 1);
+    }
+    return false;
+}
+
+// Reads the records of the log at |path| into |entries|, later ones winning. |validLength| is
+// set to the length of the complete records. Returns false if there is no such log.
+bool SelectionStore::readLog(const std::string &path, EntryMap *entries, int *recordCount,
+        long *validLength) const {
+    *recordCount = 0;
+    *validLength = 0;
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+    std::string data;
+    char buffer[4096];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        data.append(buffer, read);
+    }
+    fclose(file);
+    const uint8_t *const log = reinterpret_cast<const uint8_t *>(data.data());
+    const long size = static_cast<long>(data.size());
+    long pos = 0;
+    while (pos + 2 <= size) {
+        const int keyLength = readInt(log, pos, 2);
+        const long valuePos = pos + 2 + keyLength;
+        if (valuePos + 2 > size) {
+            break;
+        }
+        const int valueLength = readInt(log, valuePos, 2);
+        const long end = valuePos + 2 + valueLength;
+        if (end > size) {
+            break;
+        }
+        (*entries)[data.substr(pos + 2, keyLength)] = data.substr(valuePos + 2, valueLength);
+        ++*recordCount;
+        pos = end;
+    }
+    *validLength = pos;
+    return true;
+}
+
+// FNV-1a
+unsigned int SelectionStore::getHash(const char *s, const int length) {
+    unsigned int hash = 2166136261u;
+    for (int i = 0; i < length; ++i) {
+        hash = (hash ^ static_cast<uint8_t>(s[i])) * 16777619u;
+    }
+    return hash;
+}
+
+void SelectionStore::appendRecord(const std::string &key, const std::string &value,
+        std::string *out) {
+    appendInt(static_cast<unsigned int>(key.size()), 2, out);
+    out->append(key);
+    appendInt(static_cast<unsigned int>(value.size()), 2, out);
+    out->append(value);
+}
+
+bool SelectionStore::writeFully(const int fd, const std::string &data) {
+    size_t written = 0;
+    while (written < data.size()) {
+        const ssize_t result = write(fd, data.data() + written, data.size() - written);
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        written += result;
+    }
+    return true;
+}
+
+} // namespace avro
@@ -0,0 +1,102 @@
+#ifndef AVRO_SELECTION_STORE_H
+#define AVRO_SELECTION_STORE_H
+
+#include <pthread.h>
+#include <stdint.h>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "defines.h"
+
+namespace avro {
+
+// The candidates the user picked, keyed by what they typed. Replaces the js
+// _candidateSelections object, which got written out as a whole JSON file on every commit.
+//
+// Two files on disk:
+//   <path>      A compacted hash table, mapped read only, so opening it costs nothing however
+//               much has been learned. All values are big endian.
+//                 Magic number (4 bytes) 0x41 0x56 0x53 0x4C, version (2 bytes), unused
+//                 (2 bytes), slot count (4 bytes, a power of two), entry count (4 bytes)
+//                 Slot count times: entry offset from the start of the file (4 bytes, 0 if
+//                   empty), slots are probed linearly from the FNV-1a hash of the key
+//                 Entry count times: a record, as below
+//   <path>.log  Everything added since, one record appended per put():
+//                 Key length (2 bytes), key, value length (2 bytes), value
+//
+// Once the log grows past COMPACTION_THRESHOLD records it is set aside as <path>.log.old and a
+// thread of its own merges it into a new table, while puts carry on into a fresh log. Should
+// that be interrupted, the old log is simply read again on the next open.
+class SelectionStore {
+ public:
+    SelectionStore();
+    ~SelectionStore();
+
+    bool open(const char *path);
+    void close();
+    bool isOpen() const {
+        return mLogFd >= 0;
+    }
+
+    // Works without a file too, the selections are then forgotten on close().
+    bool find(const std::string &key, std::string *value);
+    void put(const std::string &key, const std::string &value);
+
+ private:
+    DISALLOW_COPY_AND_ASSIGN(SelectionStore);
+
+    typedef std::map<std::string, std::string> EntryMap;
+
+    static const int MAGIC_NUMBER = 0x4156534C;
+    static const int FORMAT_VERSION = 1;
+    static const int HEADER_SIZE = 16;
+    static const int SLOT_SIZE = 4;
+    static const int MAX_STRING_LENGTH = 0xFFFF;
+    static const int COMPACTION_THRESHOLD = 512;
+
+    typedef enum {
+        COMPACTION_IDLE,
+        COMPACTION_RUNNING,
+        COMPACTION_SUCCEEDED,
+        COMPACTION_FAILED,
+    } CompactionState;
+
+    static void *runCompaction(void *store);
+    static unsigned int getHash(const char *s, const int length);
+    static void appendRecord(const std::string &key, const std::string &value,
+            std::string *out);
+    static bool writeFully(const int fd, const std::string &data);
+
+    bool mapTable();
+    void unmapTable();
+    bool readRecord(const int offset, std::string *key, std::string *value) const;
+    bool findInTable(const std::string &key, std::string *value) const;
+    bool readLog(const std::string &path, EntryMap *entries, int *recordCount,
+            long *validLength) const;
+    void startCompaction();
+    void finishCompaction();
+    bool compact() const;
+
+    std::string mPath;
+    void *mTableAddr;
+    size_t mTableSize;
+    int mSlotCount;
+    // Added since the last compaction, and set aside for the one running now.
+    EntryMap mLogEntries;
+    EntryMap mOldLogEntries;
+    int mLogFd;
+    int mLogRecordCount;
+    bool mHasOldLog;
+    bool mCanCompact;
+
+    pthread_t mCompactionThread;
+    // Guards |mCompactionState|. While a compaction runs, the table and |mOldLogEntries| are
+    // only ever read, by both threads.
+    pthread_mutex_t mMutex;
+    CompactionState mCompactionState;
+};
+
+} // namespace avro
+#endif // AVRO_SELECTION_STORE_H
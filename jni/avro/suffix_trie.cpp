@@ -0,0 +1,55 @@
+#include <cstring>
+
+#include "suffix_trie.h"
+#include "suggestion_builder.h"
+
+namespace avro {
+
+SuffixTrie::SuffixTrie(const StringTable *table) : mTrie() {
+    const TrieNode root = { '\0', NULL, -1, -1 };
+    mTrie.push_back(root);
+    for (int i = 0; i < table->count; ++i) {
+        addKey(table->pairs[i].key, table->pairs[i].value);
+    }
+}
+
+void SuffixTrie::addKey(const char *key, const char *value) {
+    int node = 0;
+    for (int i = static_cast<int>(strlen(key)) - 1; i >= 0; --i) {
+        int child = findChild(node, key[i]);
+        if (child < 0) {
+            child = static_cast<int>(mTrie.size());
+            const TrieNode newNode = { key[i], NULL, -1, mTrie[node].firstChild };
+            mTrie.push_back(newNode);
+            mTrie[node].firstChild = child;
+        }
+        node = child;
+    }
+    mTrie[node].value = value;
+}
+
+int SuffixTrie::findChild(const int node, const char c) const {
+    for (int child = mTrie[node].firstChild; child >= 0; child = mTrie[child].nextSibling) {
+        if (mTrie[child].c == c) {
+            return child;
+        }
+    }
+    return -1;
+}
+
+void SuffixTrie::findSuffixes(const std::string &text, std::vector<SuffixMatch> *matches) const {
+    matches->clear();
+    int node = 0;
+    for (int start = static_cast<int>(text.size()) - 1; start > 0; --start) {
+        node = findChild(node, text[start]);
+        if (node < 0) {
+            return;
+        }
+        if (mTrie[node].value) {
+            const SuffixMatch match = { start, mTrie[node].value };
+            matches->push_back(match);
+        }
+    }
+}
+
+} // namespace avro
@@ -0,0 +1,48 @@
+#ifndef AVRO_SUFFIX_TRIE_H
+#define AVRO_SUFFIX_TRIE_H
+
+#include <string>
+#include <vector>
+
+#include "defines.h"
+
+namespace avro {
+
+struct StringTable;
+
+// An input ending in one of the suffixes of a table, split into its stem and the suffix.
+struct SuffixMatch {
+    // Where the suffix starts, so also the length of the stem.
+    int start;
+    const char *value;
+};
+
+// The keys of a table stored back to front in a trie, so that every key a text ends with is
+// found in one pass from its end rather than by looking up each of its tails in turn.
+class SuffixTrie {
+ public:
+    explicit SuffixTrie(const StringTable *table);
+
+    // The keys |text| ends with, shortest first. Keys that would take all of |text| are left
+    // out, as there has to be a stem to add them to.
+    void findSuffixes(const std::string &text, std::vector<SuffixMatch> *matches) const;
+
+ private:
+    DISALLOW_IMPLICIT_CONSTRUCTORS(SuffixTrie);
+
+    // Children of a node are chained through |nextSibling|, the root is node 0.
+    struct TrieNode {
+        char c;
+        const char *value;
+        int firstChild;
+        int nextSibling;
+    };
+
+    void addKey(const char *key, const char *value);
+    int findChild(const int node, const char c) const;
+
+    std::vector<TrieNode> mTrie;
+};
+
+} // namespace avro
+#endif // AVRO_SUFFIX_TRIE_H
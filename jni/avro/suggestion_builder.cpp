@@ -0,0 +1,394 @@
+#include <algorithm>
+#include <cstring>
+
+#include "suggestion_builder.h"
+#include "trace.h"
+#include "utf8.h"
+
+namespace avro {
+
+// The characters _separatePadding() treats as padding, besides ":`" and ".`".
+static const char *const PADDING_CHARS = "-]~!@#%&*()_=+[{}'\";<>/?|.,";
+
+static const int CODE_POINT_KHANDA_TA = 0x09CE;
+static const int CODE_POINT_ANUSVARA = 0x0982;
+static const char *const YA_WITH_NUKTA = "\xe0\xa7\x9f"; // U+09DF
+static const char *const TA = "\xe0\xa6\xa4";            // U+09A4
+static const char *const NGA = "\xe0\xa6\x99";           // U+0999
+
+static const int KARS[] = {
+    0x09BE, 0x09BF, 0x09C0, 0x09C1, 0x09C2, 0x09C3, 0x09C7, 0x09C8, 0x09CB, 0x09CC, 0x09C4,
+};
+static const int VOWELS[] = {
+    0x0985, 0x0986, 0x0987, 0x0988, 0x0989, 0x098A, 0x098B, 0x098F, 0x0990, 0x0993, 0x0994,
+    0x098C, 0x09E1, 0x09BE, 0x09BF, 0x09C0, 0x09C1, 0x09C2, 0x09C3, 0x09C7, 0x09C8, 0x09CB,
+    0x09CC,
+};
+
+static bool contains(const int *codePoints, const int count, const int codePoint) {
+    return std::find(codePoints, codePoints + count, codePoint) != codePoints + count;
+}
+
+// Length of the padding token at |pos|, or 0 if there is none.
+static int getPaddingLength(const std::string &s, const size_t pos) {
+    if (pos >= s.size()) {
+        return 0;
+    }
+    if (pos + 1 < s.size() && s[pos + 1] == '`' && (s[pos] == ':' || s[pos] == '.')) {
+        return 2;
+    }
+    return strchr(PADDING_CHARS, s[pos]) && s[pos] != '\0' ? 1 : 0;
+}
+
+static bool startsWithCommas(const std::string &s, const size_t pos) {
+    return s.compare(pos, 2, ",,") == 0;
+}
+
+namespace {
+// A candidate and its edit distance to the classic transliteration.
+struct RankedWord {
+    int distance;
+    int index;
+};
+
+bool compareDistance(const RankedWord &a, const RankedWord &b) {
+    return a.distance < b.distance;
+}
+} // namespace
+
+const char *findString(const StringTable &table, const std::string &key) {
+    int low = 0;
+    int high = table.count - 1;
+    while (low <= high) {
+        const int mid = (low + high) / 2;
+        const int c = strcmp(table.pairs[mid].key, key.c_str());
+        if (c == 0) {
+            return table.pairs[mid].value;
+        }
+        if (c < 0) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return NULL;
+}
+
+SuggestionBuilder::SuggestionBuilder(Dictionary *dictionary)
+        : mDictionary(dictionary), mSearchSession(dictionary), mParser(&AVRO_PHONETIC_DATA),
+          mSuffixes(&AVRO_SUFFIX_DATA), mSuffixMatches(), mSuffixedWord(),
+          mPhoneticCache(PHONETIC_CACHE_CAPACITY), mClassicCache(CLASSIC_CACHE_CAPACITY),
+          mTempCache(), mSelections(), mEditDistance(), mCodePoints() {
+}
+
+void SuggestionBuilder::reset() {
+    mSearchSession.reset();
+    mPhoneticCache.clear();
+}
+
+int SuggestionBuilder::trimMemory() {
+    // The frontiers point into the tables.
+    mSearchSession.reset();
+    return mDictionary->dropTables();
+}
+
+void SuggestionBuilder::getCacheStats(CacheStats *phoneticStats, CacheStats *classicStats) const {
+    *phoneticStats = mPhoneticCache.getStats();
+    *classicStats = mClassicCache.getStats();
+}
+
+// Roughly what |words| take in memory.
+size_t SuggestionBuilder::getSize(const std::vector<std::string> &words) {
+    size_t size = sizeof(words);
+    for (size_t i = 0; i < words.size(); ++i) {
+        size += sizeof(words[i]) + words[i].size();
+    }
+    return size;
+}
+
+// Does what this regular expression of the js does, with T standing for a padding token:
+//   /(^T*?(?=(?:,{2,}))|^T*)(.*?(?:,,)*)(T*$)/
+void SuggestionBuilder::separatePadding(const std::string &input, Padding *padding) {
+    const size_t length = input.size();
+    // The leading padding stops short of the first ",," it runs into.
+    size_t begin = 0;
+    while (!startsWithCommas(input, begin)) {
+        const int paddingLength = getPaddingLength(input, begin);
+        if (paddingLength == 0) {
+            break;
+        }
+        begin += paddingLength;
+    }
+    // isTrailing[i] is set when everything from |i| on is padding.
+    std::vector<char> isTrailing(length + 1, 0);
+    isTrailing[length] = 1;
+    for (size_t i = length; i-- > begin;) {
+        const int paddingLength = getPaddingLength(input, i);
+        isTrailing[i] = paddingLength > 0 && isTrailing[i + paddingLength];
+    }
+    // The middle is as short as possible, but takes as many ",," as it can after that.
+    size_t end = length;
+    for (size_t pos = begin; pos < length; ++pos) {
+        size_t commas = pos;
+        while (startsWithCommas(input, commas)) {
+            commas += 2;
+        }
+        while (commas > pos && !isTrailing[commas]) {
+            commas -= 2;
+        }
+        if (isTrailing[commas]) {
+            end = commas;
+            break;
+        }
+    }
+    padding->begin = input.substr(0, begin);
+    padding->middle = input.substr(begin, end - begin);
+    padding->end = input.substr(end);
+}
+
+// The js toLowerCase(), as far as the ascii input from the keyboard is concerned.
+void SuggestionBuilder::toLowerCase(const std::string &input, std::string *output) {
+    output->assign(input);
+    for (size_t i = 0; i < output->size(); ++i) {
+        if ((*output)[i] >= 'A' && (*output)[i] <= 'Z') {
+            (*output)[i] += 'a' - 'A';
+        }
+    }
+}
+
+// The last code point of |word|, and where it starts.
+int SuggestionBuilder::getLastCodePoint(const std::string &word, int *start) {
+    int lastStart = static_cast<int>(word.size());
+    while (lastStart > 0 && (word[lastStart - 1] & 0xC0) == 0x80) {
+        --lastStart;
+    }
+    if (lastStart > 0) {
+        --lastStart;
+    }
+    *start = lastStart;
+    int pos = lastStart;
+    return word.empty() ? 0 : decodeUtf8(word.data(), static_cast<int>(word.size()), &pos);
+}
+
+// Appends the Bengali |suffix| to |word|, fixing up the joint the way _addSuffix() does.
+void SuggestionBuilder::addSuffix(const std::string &word, const char *suffix,
+        std::string *output) {
+    int lastStart = 0;
+    const int last = getLastCodePoint(word, &lastStart);
+    int pos = 0;
+    const int suffixLength = static_cast<int>(strlen(suffix));
+    const int first = suffixLength == 0 ? 0 : decodeUtf8(suffix, suffixLength, &pos);
+
+    if (contains(VOWELS, NELEMS(VOWELS), last) && contains(KARS, NELEMS(KARS), first)) {
+        output->assign(word).append(YA_WITH_NUKTA);
+    } else if (last == CODE_POINT_KHANDA_TA) {
+        output->assign(word, 0, lastStart).append(TA);
+    } else if (last == CODE_POINT_ANUSVARA) {
+        output->assign(word, 0, lastStart).append(NGA);
+    } else {
+        output->assign(word);
+    }
+    output->append(suffix);
+}
+
+// A stable sort, like the Array.sort() the js relies on, so equally distant words keep their
+// order. Every distance is computed once rather than at every comparison.
+void SuggestionBuilder::sortByPhoneticRelevance(const std::string &classic,
+        std::vector<std::string> *words) {
+    utf8ToCodePoints(classic, &mCodePoints);
+    mEditDistance.setPattern(mCodePoints);
+    std::vector<RankedWord> ranked(words->size());
+    for (size_t i = 0; i < words->size(); ++i) {
+        utf8ToCodePoints((*words)[i], &mCodePoints);
+        ranked[i].distance = mEditDistance.getDistance(mCodePoints);
+        ranked[i].index = static_cast<int>(i);
+    }
+    std::stable_sort(ranked.begin(), ranked.end(), compareDistance);
+    std::vector<std::string> sorted(words->size());
+    for (size_t i = 0; i < ranked.size(); ++i) {
+        sorted[i].swap((*words)[ranked[i].index]);
+    }
+    words->swap(sorted);
+}
+
+bool SuggestionBuilder::getAutocorrect(const std::string &input, const Padding &padding,
+        std::string *corrected, bool *exact) const {
+    const char *value = findString(AVRO_AUTOCORRECT_DATA, input);
+    if (value) {
+        *exact = input == value;
+        if (*exact) {
+            corrected->assign(input);
+        } else {
+            mParser.parse(value, corrected);
+        }
+        return true;
+    }
+    std::string fixed;
+    mParser.fixString(padding.middle, &fixed);
+    value = findString(AVRO_AUTOCORRECT_DATA, fixed);
+    if (!value) {
+        return false;
+    }
+    *exact = false;
+    mParser.parse(value, corrected);
+    return true;
+}
+
+// _addSuffix(): the cached words for |key|, followed by every cached stem of |key| with the
+// matching suffix added. The stems are remembered in |mTempCache| for stringCommitted().
+void SuggestionBuilder::getSuffixSuggestions(const std::string &key,
+        std::vector<std::string> *words) {
+    const std::vector<std::string> *cached = mPhoneticCache.get(key);
+    if (cached) {
+        *words = *cached;
+    } else {
+        words->clear();
+    }
+    mTempCache.clear();
+    // Longest suffix first, as the js goes through the splits.
+    mSuffixes.findSuffixes(key, &mSuffixMatches);
+    for (int i = static_cast<int>(mSuffixMatches.size()) - 1; i >= 0; --i) {
+        const SuffixMatch &match = mSuffixMatches[i];
+        const std::string stemKey = key.substr(0, match.start);
+        // Most splits have no cached stem, and probing them should not skew the cache stats.
+        if (!mPhoneticCache.contains(stemKey)) {
+            continue;
+        }
+        const std::vector<std::string> *stems = mPhoneticCache.get(stemKey);
+        for (size_t j = 0; j < stems->size(); ++j) {
+            const std::string &stem = (*stems)[j];
+            addSuffix(stem, match.value, &mSuffixedWord);
+            words->push_back(mSuffixedWord);
+            int lastStart = 0;
+            // The js forgets to remember the stems ending in anusvara.
+            if (getLastCodePoint(stem, &lastStart) != CODE_POINT_ANUSVARA
+                    && mTempCache.find(mSuffixedWord) == mTempCache.end()) {
+                mTempCache[mSuffixedWord] = std::make_pair(stem, stemKey);
+            }
+        }
+    }
+}
+
+// _getPreviousSelection(): the index in |words| of the candidate picked the last time
+// |middle| was typed, or of the one picked for its stem with the suffix added.
+int SuggestionBuilder::getPreviousSelection(const std::string &middle,
+        const std::vector<std::string> &words) {
+    std::string selection;
+    if (!mSelections.find(middle, &selection)) {
+        // Suffixes are matched lower cased, stems as typed.
+        std::string lowerMiddle;
+        toLowerCase(middle, &lowerMiddle);
+        mSuffixes.findSuffixes(lowerMiddle, &mSuffixMatches);
+        std::string stemSelection;
+        for (size_t i = 0; i < mSuffixMatches.size(); ++i) {
+            const SuffixMatch &match = mSuffixMatches[i];
+            if (mSelections.find(middle.substr(0, match.start), &stemSelection)) {
+                addSuffix(stemSelection, match.value, &selection);
+                mSelections.put(middle, selection);
+                break;
+            }
+        }
+    }
+    const std::vector<std::string>::const_iterator it =
+            std::find(words.begin(), words.end(), selection);
+    return it == words.end() ? 0 : static_cast<int>(it - words.begin());
+}
+
+bool SuggestionBuilder::openSelections(const char *path) {
+    return mSelections.open(path);
+}
+
+void SuggestionBuilder::updateCandidateSelection(const std::string &input,
+        const std::string &word) {
+    Padding padding;
+    separatePadding(input, &padding);
+    mSelections.put(padding.middle, word);
+}
+
+// Picking a word made of a stem and a suffix teaches the stem too, unless it has been picked
+// before.
+void SuggestionBuilder::stringCommitted(const std::string &word) {
+    const std::map<std::string, std::pair<std::string, std::string> >::const_iterator it =
+            mTempCache.find(word);
+    if (it == mTempCache.end()) {
+        return;
+    }
+    std::string selection;
+    if (!mSelections.find(it->second.second, &selection)) {
+        mSelections.put(it->second.second, it->second.first);
+    }
+}
+
+void SuggestionBuilder::suggest(const std::string &input, std::vector<std::string> *words,
+        int *selection) {
+    AVRO_TRACE("suggest");
+    words->clear();
+    Padding padding;
+    separatePadding(input, &padding);
+    std::string begin;
+    std::string end;
+    mParser.parse(padding.begin, &begin);
+    mParser.parse(padding.end, &end);
+    const std::string *cachedClassic = mClassicCache.get(padding.middle);
+    std::string classic;
+    if (cachedClassic) {
+        classic = *cachedClassic;
+    } else {
+        AVRO_TRACE("suggest.classic");
+        mParser.parse(padding.middle, &classic);
+        mClassicCache.put(padding.middle, classic, classic.size());
+    }
+
+    std::string key;
+    toLowerCase(padding.middle, &key);
+    std::vector<std::string> dictionaryWords;
+    const std::vector<std::string> *cached = mPhoneticCache.get(key);
+    const bool isCached = cached != NULL;
+    if (isCached) {
+        dictionaryWords = *cached;
+    } else {
+        AVRO_TRACE("suggest.search");
+        mSearchSession.search(key, &dictionaryWords);
+    }
+
+    std::string corrected;
+    bool exact = false;
+    if (getAutocorrect(input, padding, &corrected, &exact)) {
+        words->push_back(corrected);
+        if (!exact) {
+            dictionaryWords.push_back(corrected);
+        }
+    }
+    if (!isCached && !dictionaryWords.empty()) {
+        mPhoneticCache.put(key, dictionaryWords, getSize(dictionaryWords));
+    }
+
+    std::vector<std::string> candidates;
+    {
+        AVRO_TRACE("suggest.suffix");
+        getSuffixSuggestions(key, &candidates);
+    }
+    {
+        AVRO_TRACE("suggest.sort");
+        sortByPhoneticRelevance(classic, &candidates);
+    }
+    candidates.push_back(classic);
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        if (std::find(words->begin(), words->end(), candidates[i]) == words->end()) {
+            words->push_back(candidates[i]);
+        }
+    }
+
+    {
+        AVRO_TRACE("suggest.selection");
+        *selection = getPreviousSelection(padding.middle, *words);
+    }
+
+    for (size_t i = 0; i < words->size(); ++i) {
+        if (!exact || (*words)[i] != corrected) {
+            (*words)[i] = begin + (*words)[i] + end;
+        }
+    }
+}
+
+} // namespace avro
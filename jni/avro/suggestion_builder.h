@@ -0,0 +1,117 @@
+#ifndef AVRO_SUGGESTION_BUILDER_H
+#define AVRO_SUGGESTION_BUILDER_H
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "defines.h"
+#include "dictionary.h"
+#include "edit_distance.h"
+#include "lru_cache.h"
+#include "phonetic.h"
+#include "search_session.h"
+#include "selection_store.h"
+#include "suffix_trie.h"
+
+namespace avro {
+
+struct StringPair {
+    const char *key;
+    const char *value;
+};
+
+// A js object used as a map, with its pairs sorted by key.
+struct StringTable {
+    const StringPair *pairs;
+    int count;
+};
+
+// The autocorrect and suffixdict tables from assets/avro.min.js, see suggestion_data.cpp.
+extern const StringTable AVRO_AUTOCORRECT_DATA;
+extern const StringTable AVRO_SUFFIX_DATA;
+
+// Returns the value for |key|, or NULL if the table has none.
+const char *findString(const StringTable &table, const std::string &key);
+
+// Native port of the js SuggestionBuilder, which turns what has been typed so far into the
+// list of candidates shown above the keyboard: the autocorrect entry, the dictionary words
+// (with suffixes added to the stems seen before) ranked by their edit distance to the classic
+// transliteration, and the classic transliteration itself.
+class SuggestionBuilder {
+ public:
+    explicit SuggestionBuilder(Dictionary *dictionary);
+
+    // Same words, in the same order, as suggest(input).words of the js version, and
+    // suggest(input).prevSelection in |selection|.
+    void suggest(const std::string &input, std::vector<std::string> *words, int *selection);
+    // Where the candidates picked are remembered, they are only kept in memory without it.
+    bool openSelections(const char *path);
+    // The js updateCandidateSelection() and stringCommitted(), for when the user picks |word|
+    // out of the candidates for |input|.
+    void updateCandidateSelection(const std::string &input, const std::string &word);
+    void stringCommitted(const std::string &word);
+    // Drops what was found so far, for when the dictionary has been opened again.
+    void reset();
+    // Unmaps the dictionary tables, which get mapped again as they are needed. Returns how
+    // many were dropped.
+    int trimMemory();
+    void getCacheStats(CacheStats *phoneticStats, CacheStats *classicStats) const;
+
+ private:
+    DISALLOW_IMPLICIT_CONSTRUCTORS(SuggestionBuilder);
+
+    // Punctuation around the input is transliterated on its own and put back around every
+    // candidate.
+    struct Padding {
+        Padding() : begin(), middle(), end() {}
+
+        std::string begin;
+        std::string middle;
+        std::string end;
+    };
+
+    // Hundreds of inputs worth of words, and thousands of transliterations.
+    static const size_t PHONETIC_CACHE_CAPACITY = 512 * 1024;
+    static const size_t CLASSIC_CACHE_CAPACITY = 128 * 1024;
+
+    static void separatePadding(const std::string &input, Padding *padding);
+    static void toLowerCase(const std::string &input, std::string *output);
+    static int getLastCodePoint(const std::string &word, int *start);
+    static void addSuffix(const std::string &word, const char *suffix, std::string *output);
+    static size_t getSize(const std::vector<std::string> &words);
+
+    void sortByPhoneticRelevance(const std::string &classic, std::vector<std::string> *words);
+    bool getAutocorrect(const std::string &input, const Padding &padding,
+            std::string *corrected, bool *exact) const;
+    void getSuffixSuggestions(const std::string &key, std::vector<std::string> *words);
+    int getPreviousSelection(const std::string &middle, const std::vector<std::string> &words);
+
+    Dictionary *const mDictionary;
+    // Successive inputs mostly differ by their last letter, so the dictionary is searched
+    // incrementally.
+    SearchSession mSearchSession;
+    const PhoneticParser mParser;
+    const SuffixTrie mSuffixes;
+    // Reused across calls, so splitting off the suffixes and joining them to the stems does
+    // not allocate once they have grown.
+    std::vector<SuffixMatch> mSuffixMatches;
+    std::string mSuffixedWord;
+    // Dictionary words found for each lower cased input, suffixes are only ever added to the
+    // stems found in here. Unlike the js one it is bounded, so a stem typed long ago may no
+    // longer get its suffixes.
+    LruCache<std::vector<std::string> > mPhoneticCache;
+    // The classic transliteration of each input, without the padding.
+    LruCache<std::string> mClassicCache;
+    // The stem, and what was typed for it, of every word the last suggest() built by adding a
+    // suffix.
+    std::map<std::string, std::pair<std::string, std::string> > mTempCache;
+    SelectionStore mSelections;
+    // Candidates are ranked by their distance to the classic transliteration.
+    EditDistance mEditDistance;
+    std::vector<int> mCodePoints;
+};
+
+} // namespace avro
+#endif // AVRO_SUGGESTION_BUILDER_H
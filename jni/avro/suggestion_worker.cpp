@@ -0,0 +1,127 @@
+#include "suggestion_worker.h"
+#include "trace.h"
+
+namespace avro {
+
+SuggestionWorker::SuggestionWorker(SuggestionBuilder *builder, SuggestionListener *listener)
+        : mBuilder(builder), mListener(listener), mThread(), mIsRunning(false),
+          mBuilderMutex(), mMutex(), mCondition(), mIsStopping(false), mHasRequest(false),
+          mSequence(0), mInput() {
+    pthread_mutex_init(&mBuilderMutex, NULL);
+    pthread_mutex_init(&mMutex, NULL);
+    pthread_cond_init(&mCondition, NULL);
+}
+
+SuggestionWorker::~SuggestionWorker() {
+    stop();
+    pthread_cond_destroy(&mCondition);
+    pthread_mutex_destroy(&mMutex);
+    pthread_mutex_destroy(&mBuilderMutex);
+}
+
+bool SuggestionWorker::start() {
+    if (mIsRunning) {
+        return true;
+    }
+    mIsStopping = false;
+    mHasRequest = false;
+    if (pthread_create(&mThread, NULL, run, this) != 0) {
+        AVRO_LOGE("Can't start the suggestion worker");
+        return false;
+    }
+    mIsRunning = true;
+    return true;
+}
+
+void SuggestionWorker::stop() {
+    if (!mIsRunning) {
+        return;
+    }
+    pthread_mutex_lock(&mMutex);
+    mIsStopping = true;
+    pthread_cond_signal(&mCondition);
+    pthread_mutex_unlock(&mMutex);
+    pthread_join(mThread, NULL);
+    mIsRunning = false;
+}
+
+void SuggestionWorker::post(const int sequence, const std::string &input) {
+    pthread_mutex_lock(&mMutex);
+    mSequence = sequence;
+    mInput = input;
+    mHasRequest = true;
+    pthread_cond_signal(&mCondition);
+    pthread_mutex_unlock(&mMutex);
+}
+
+void SuggestionWorker::suggest(const std::string &input, std::vector<std::string> *words,
+        int *selection) {
+    // Includes the wait for the builder, which the other thread may hold.
+    AVRO_TRACE("worker.suggest");
+    pthread_mutex_lock(&mBuilderMutex);
+    mBuilder->suggest(input, words, selection);
+    pthread_mutex_unlock(&mBuilderMutex);
+}
+
+void SuggestionWorker::selectCandidate(const std::string &input, const std::string &word) {
+    pthread_mutex_lock(&mBuilderMutex);
+    mBuilder->updateCandidateSelection(input, word);
+    mBuilder->stringCommitted(word);
+    pthread_mutex_unlock(&mBuilderMutex);
+}
+
+void SuggestionWorker::getCacheStats(CacheStats *phoneticStats, CacheStats *classicStats) {
+    pthread_mutex_lock(&mBuilderMutex);
+    mBuilder->getCacheStats(phoneticStats, classicStats);
+    pthread_mutex_unlock(&mBuilderMutex);
+}
+
+int SuggestionWorker::trimMemory() {
+    pthread_mutex_lock(&mBuilderMutex);
+    const int dropped = mBuilder->trimMemory();
+    pthread_mutex_unlock(&mBuilderMutex);
+    return dropped;
+}
+
+void *SuggestionWorker::run(void *worker) {
+    static_cast<SuggestionWorker *>(worker)->loop();
+    return NULL;
+}
+
+void SuggestionWorker::loop() {
+    mListener->onWorkerStarted();
+    std::string input;
+    std::vector<std::string> words;
+    int selection = 0;
+    pthread_mutex_lock(&mMutex);
+    for (;;) {
+        while (!mHasRequest && !mIsStopping) {
+            pthread_cond_wait(&mCondition, &mMutex);
+        }
+        if (mIsStopping) {
+            break;
+        }
+        const int sequence = mSequence;
+        input.swap(mInput);
+        mHasRequest = false;
+        pthread_mutex_unlock(&mMutex);
+
+        suggest(input, &words, &selection);
+
+        pthread_mutex_lock(&mMutex);
+        if (mHasRequest || mIsStopping) {
+            // Overtaken by a newer keystroke, nobody is waiting for these any more.
+            continue;
+        }
+        pthread_mutex_unlock(&mMutex);
+        {
+            AVRO_TRACE("worker.deliver");
+            mListener->onSuggestions(sequence, words, selection);
+        }
+        pthread_mutex_lock(&mMutex);
+    }
+    pthread_mutex_unlock(&mMutex);
+    mListener->onWorkerStopped();
+}
+
+} // namespace avro
@@ -0,0 +1,70 @@
+#ifndef AVRO_SUGGESTION_WORKER_H
+#define AVRO_SUGGESTION_WORKER_H
+
+#include <pthread.h>
+#include <string>
+#include <vector>
+
+#include "defines.h"
+#include "suggestion_builder.h"
+
+namespace avro {
+
+class SuggestionListener {
+ public:
+    virtual ~SuggestionListener() {}
+
+    // Called on the worker thread, before the first and after the last onSuggestions().
+    virtual void onWorkerStarted() {}
+    virtual void onWorkerStopped() {}
+    virtual void onSuggestions(const int sequence, const std::vector<std::string> &words,
+            const int selection) = 0;
+};
+
+// Builds suggestions on a thread of its own, so that the keyboard never waits for the
+// dictionary. Only the latest keystroke matters: a request still waiting is replaced by the
+// next one, and the results of a request that got overtaken while it ran are dropped.
+class SuggestionWorker {
+ public:
+    SuggestionWorker(SuggestionBuilder *builder, SuggestionListener *listener);
+    ~SuggestionWorker();
+
+    bool start();
+    void stop();
+    bool isRunning() const {
+        return mIsRunning;
+    }
+
+    // Queues |input|, its suggestions are delivered to the listener tagged with |sequence|.
+    void post(const int sequence, const std::string &input);
+    // Builds the suggestions for |input| on the calling thread, taking turns with the worker.
+    void suggest(const std::string &input, std::vector<std::string> *words, int *selection);
+    // Remembers that |word| was picked for |input|, taking turns with the worker.
+    void selectCandidate(const std::string &input, const std::string &word);
+    void getCacheStats(CacheStats *phoneticStats, CacheStats *classicStats);
+    // SuggestionBuilder::trimMemory(), once the worker is done with the builder.
+    int trimMemory();
+
+ private:
+    DISALLOW_IMPLICIT_CONSTRUCTORS(SuggestionWorker);
+
+    static void *run(void *worker);
+    void loop();
+
+    SuggestionBuilder *const mBuilder;
+    SuggestionListener *const mListener;
+    pthread_t mThread;
+    bool mIsRunning;
+    // Serializes the use of |mBuilder|.
+    pthread_mutex_t mBuilderMutex;
+    // Guards the request below and |mIsStopping|.
+    pthread_mutex_t mMutex;
+    pthread_cond_t mCondition;
+    bool mIsStopping;
+    bool mHasRequest;
+    int mSequence;
+    std::string mInput;
+};
+
+} // namespace avro
+#endif // AVRO_SUGGESTION_WORKER_H
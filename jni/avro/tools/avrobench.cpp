@@ -0,0 +1,230 @@
+// Replays keystroke traces through the native suggestion pipeline the way PhoneticIM.onPress()
+// drives it, to catch regressions before they reach a phone.
+//
+//   avrobench [-n passes] [-t trace.json] <avrodict.dict> <trace>...
+//
+// A trace is plain text typed one byte at a time: every byte is a key, a space or a line end
+// commits what was typed, and "<" is a backspace. Each keystroke asks for the suggestions of
+// what has been typed so far. Reports the cold start (opening the dictionary and setting up
+// the builder), the per keystroke latency, the peak RSS and the allocations per keystroke.
+// With more than one pass the trace is replayed again on the warm caches. -t records the
+// spans of the engine stages and writes them out in the Chrome trace format.
+//
+// Built for the host by jni/avro/Makefile, "make -C jni/avro bench" runs it on the traces in
+// tools/traces.
+
+#include <sys/resource.h>
+#include <time.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "dictionary.h"
+#include "suggestion_builder.h"
+#include "trace.h"
+
+namespace {
+
+// Every operator new of the process goes through these, the engine's included. The bench
+// itself runs on a single thread, so plain counters do.
+size_t allocationCount = 0;
+size_t allocationBytes = 0;
+
+void *allocate(const size_t size) {
+    ++allocationCount;
+    allocationBytes += size;
+    void *p = malloc(size ? size : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+} // namespace
+
+// The exception specifications <new> declares these with, which C++17 no longer has.
+#if __cplusplus >= 201103L
+#define THROWS_BAD_ALLOC
+#define THROWS_NOTHING noexcept
+#else
+#define THROWS_BAD_ALLOC throw(std::bad_alloc)
+#define THROWS_NOTHING throw()
+#endif
+
+void *operator new(size_t size) THROWS_BAD_ALLOC {
+    return allocate(size);
+}
+
+void *operator new[](size_t size) THROWS_BAD_ALLOC {
+    return allocate(size);
+}
+
+void operator delete(void *p) THROWS_NOTHING {
+    free(p);
+}
+
+void operator delete[](void *p) THROWS_NOTHING {
+    free(p);
+}
+
+#if __cplusplus >= 201402L
+void operator delete(void *p, size_t) THROWS_NOTHING {
+    free(p);
+}
+
+void operator delete[](void *p, size_t) THROWS_NOTHING {
+    free(p);
+}
+#endif
+
+namespace avro {
+namespace {
+
+const char KEY_BACKSPACE = '<';
+
+double getTime() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+bool readTrace(const char *path, std::string *keys) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file) {
+        fprintf(stderr, "Can't read %s\n", path);
+        return false;
+    }
+    keys->append(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// |sorted| in ascending order.
+double getPercentile(const std::vector<double> &sorted, const int percent) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    const size_t index = (sorted.size() - 1) * percent / 100;
+    return sorted[index];
+}
+
+struct PassResult {
+    PassResult() : latencies(), allocations(0), allocatedBytes(0) {}
+
+    std::vector<double> latencies;
+    size_t allocations;
+    size_t allocatedBytes;
+};
+
+void replay(const std::string &keys, SuggestionBuilder *builder, PassResult *result) {
+    std::string typed;
+    std::vector<std::string> words;
+    int selection = 0;
+    result->latencies.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        const char key = keys[i];
+        if (key == ' ' || key == '\n' || key == '\r') {
+            typed.clear();
+            continue;
+        }
+        if (key == KEY_BACKSPACE) {
+            if (!typed.empty()) {
+                typed.erase(typed.size() - 1);
+            }
+        } else {
+            typed.push_back(key);
+        }
+        const size_t count = allocationCount;
+        const size_t bytes = allocationBytes;
+        const double start = getTime();
+        builder->suggest(typed, &words, &selection);
+        result->latencies.push_back((getTime() - start) * 1e6);
+        result->allocations += allocationCount - count;
+        result->allocatedBytes += allocationBytes - bytes;
+    }
+}
+
+void printPass(const int pass, PassResult *result) {
+    std::vector<double> &latencies = result->latencies;
+    std::sort(latencies.begin(), latencies.end());
+    double total = 0;
+    for (size_t i = 0; i < latencies.size(); ++i) {
+        total += latencies[i];
+    }
+    const double count = latencies.empty() ? 1 : static_cast<double>(latencies.size());
+    printf("pass %d: %d keystrokes, p50 %.1f us, p99 %.1f us, max %.1f us, mean %.1f us, "
+            "%.1f allocations (%.0f bytes) per keystroke\n", pass,
+            static_cast<int>(latencies.size()), getPercentile(latencies, 50),
+            getPercentile(latencies, 99), latencies.empty() ? 0 : latencies.back(),
+            total / count, result->allocations / count, result->allocatedBytes / count);
+}
+
+} // namespace
+} // namespace avro
+
+int main(int argc, char **argv) {
+    int passes = 1;
+    const char *tracePath = NULL;
+    int arg = 1;
+    for (; arg + 1 < argc && argv[arg][0] == '-'; arg += 2) {
+        if (strcmp(argv[arg], "-n") == 0) {
+            passes = atoi(argv[arg + 1]);
+        } else if (strcmp(argv[arg], "-t") == 0) {
+            tracePath = argv[arg + 1];
+        } else {
+            break;
+        }
+    }
+    if (argc - arg < 2 || passes < 1) {
+        fprintf(stderr, "usage: %s [-n passes] [-t trace.json] <avrodict.dict> <trace>...\n",
+                argv[0]);
+        return 2;
+    }
+    avro::Trace::setEnabled(tracePath != NULL);
+    std::string keys;
+    for (int i = arg + 1; i < argc; ++i) {
+        if (!avro::readTrace(argv[i], &keys)) {
+            return 1;
+        }
+        keys.push_back('\n');
+    }
+
+    FILE *file = fopen(argv[arg], "rb");
+    if (!file || fseek(file, 0, SEEK_END) != 0) {
+        fprintf(stderr, "Can't open %s\n", argv[arg]);
+        return 1;
+    }
+    const long size = ftell(file);
+    fclose(file);
+
+    const size_t coldCount = allocationCount;
+    const double coldStart = avro::getTime();
+    avro::Dictionary dictionary;
+    if (!dictionary.open(argv[arg], 0, size)) {
+        return 1;
+    }
+    avro::SuggestionBuilder builder(&dictionary);
+    const double coldTime = avro::getTime() - coldStart;
+    printf("cold start: %.2f ms, %d allocations\n", coldTime * 1e3,
+            static_cast<int>(allocationCount - coldCount));
+
+    for (int pass = 1; pass <= passes; ++pass) {
+        avro::PassResult result;
+        avro::replay(keys, &builder, &result);
+        avro::printPass(pass, &result);
+    }
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    // Kilobytes on Linux.
+    printf("peak rss: %.1f MB\n", usage.ru_maxrss / 1024.0);
+    if (tracePath && !avro::Trace::dumpToFile(tracePath)) {
+        return 1;
+    }
+    return 0;
+}
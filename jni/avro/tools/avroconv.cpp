@@ -0,0 +1,169 @@
+// Transliterates roman text to Bengali with the rules of assets/avro.min.js, off the phone.
+//
+//   avroconv [-j threads] [input]
+//
+// Reads UTF-8 text from |input|, which is mapped rather than read, or from stdin when it is
+// missing or "-", and writes the Bengali to stdout line for line. Lines are parsed on as many
+// threads as there are cores unless -j says otherwise, and the throughput goes to stderr.
+//
+// Built for the host by jni/avro/Makefile, along with the engine as out/libavro.a.
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "batch_parser.h"
+#include "phonetic.h"
+
+namespace avro {
+namespace {
+
+// Input is handed to the parser this much at a time, so the output of one block is written
+// while memory stays bounded however large the input is.
+const size_t BLOCK_SIZE = 8 * 1024 * 1024;
+
+double getTime() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+bool writeOutput(const std::string &output) {
+    return fwrite(output.data(), 1, output.size(), stdout) == output.size();
+}
+
+// The end of the last complete line of the |length| bytes at |text|, or NULL if there is none.
+const char *findLastLineEnd(const char *text, const size_t length) {
+    for (const char *end = text + length; end > text; --end) {
+        if (end[-1] == '\n') {
+            return end;
+        }
+    }
+    return NULL;
+}
+
+bool convertFile(const char *path, BatchParser *parser, size_t *inputLength) {
+    const int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        fprintf(stderr, "Can't open %s\n", path);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return false;
+    }
+    *inputLength = static_cast<size_t>(st.st_size);
+    if (*inputLength == 0) {
+        close(fd);
+        return true;
+    }
+    void *addr = mmap(NULL, *inputLength, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        fprintf(stderr, "Can't mmap %s\n", path);
+        return false;
+    }
+    madvise(addr, *inputLength, MADV_SEQUENTIAL);
+    const char *const text = static_cast<const char *>(addr);
+    const char *const end = text + *inputLength;
+    std::string output;
+    bool written = true;
+    for (const char *begin = text; written && begin < end;) {
+        const char *blockEnd = end;
+        if (static_cast<size_t>(end - begin) > BLOCK_SIZE) {
+            blockEnd = findLastLineEnd(begin, BLOCK_SIZE);
+            if (!blockEnd) {
+                // A single line longer than the block is still parsed whole.
+                const char *newline = static_cast<const char *>(
+                        memchr(begin + BLOCK_SIZE, '\n', end - begin - BLOCK_SIZE));
+                blockEnd = newline ? newline + 1 : end;
+            }
+        }
+        output.clear();
+        parser->parse(begin, blockEnd - begin, &output);
+        written = writeOutput(output);
+        begin = blockEnd;
+    }
+    munmap(addr, *inputLength);
+    return written;
+}
+
+bool convertStream(FILE *file, BatchParser *parser, size_t *inputLength) {
+    std::vector<char> buffer(BLOCK_SIZE);
+    // Bytes at the start of |buffer| left over from the last read, short of a line end.
+    size_t pending = 0;
+    std::string output;
+    *inputLength = 0;
+    for (;;) {
+        if (pending == buffer.size()) {
+            buffer.resize(buffer.size() * 2);
+        }
+        const size_t count = fread(&buffer[pending], 1, buffer.size() - pending, file);
+        *inputLength += count;
+        const size_t length = pending + count;
+        if (count == 0) {
+            output.clear();
+            parser->parse(&buffer[0], length, &output);
+            return writeOutput(output) && !ferror(file);
+        }
+        const char *lineEnd = findLastLineEnd(&buffer[0], length);
+        if (!lineEnd) {
+            pending = length;
+            continue;
+        }
+        const size_t parsedLength = lineEnd - &buffer[0];
+        output.clear();
+        parser->parse(&buffer[0], parsedLength, &output);
+        if (!writeOutput(output)) {
+            return false;
+        }
+        pending = length - parsedLength;
+        memmove(&buffer[0], &buffer[parsedLength], pending);
+    }
+}
+
+} // namespace
+} // namespace avro
+
+int main(int argc, char **argv) {
+    int threadCount = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+    int arg = 1;
+    if (arg < argc && strncmp(argv[arg], "-j", 2) == 0) {
+        if (argv[arg][2] != '\0') {
+            threadCount = atoi(argv[arg] + 2);
+        } else if (arg + 1 < argc) {
+            threadCount = atoi(argv[++arg]);
+        } else {
+            threadCount = 0;
+        }
+        ++arg;
+    }
+    if (argc - arg > 1 || threadCount < 1) {
+        fprintf(stderr, "usage: %s [-j threads] [input]\n", argv[0]);
+        return 2;
+    }
+    const char *path = arg < argc && strcmp(argv[arg], "-") != 0 ? argv[arg] : NULL;
+
+    const avro::PhoneticParser phoneticParser(&avro::AVRO_PHONETIC_DATA);
+    avro::BatchParser parser(&phoneticParser, threadCount);
+    const double start = avro::getTime();
+    size_t inputLength = 0;
+    const bool converted = path ? avro::convertFile(path, &parser, &inputLength)
+            : avro::convertStream(stdin, &parser, &inputLength);
+    if (fflush(stdout) != 0 || !converted) {
+        fprintf(stderr, "Can't convert %s\n", path ? path : "stdin");
+        return 1;
+    }
+    const double seconds = avro::getTime() - start;
+    const double megabytes = inputLength / (1024.0 * 1024.0);
+    fprintf(stderr, "%.2f MB in %.3f s on %d threads, %.2f MB/s\n", megabytes, seconds,
+            threadCount, seconds > 0 ? megabytes / seconds : 0.0);
+    return 0;
+}
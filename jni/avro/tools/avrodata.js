@@ -0,0 +1,161 @@
+// Generates the native Avro tables from assets/avro.min.js.
+//
+//   node jni/avro/tools/avrodata.js assets/avro.min.js jni/avro
+//
+// avro.min.js keeps its modules in a closure, so the script is evaluated with the module map
+// exported and the tables are read back from the live objects.
+
+var fs = require('fs');
+var path = require('path');
+
+if (process.argv.length < 4) {
+    console.error('usage: node avrodata.js <avro.min.js> <output dir>');
+    process.exit(1);
+}
+
+var source = fs.readFileSync(process.argv[2], 'utf8');
+var outputDir = process.argv[3];
+
+source = source.replace('var m={},h,p=', 'var m=globalThis.__avroModules={},h,p=');
+globalThis.load_from_file = function() { return '{}'; };
+globalThis.save_to_file = function() {};
+(0, eval)(source + ';globalThis.AvroForGaia=AvroForGaia;');
+globalThis.AvroForGaia();
+var modules = globalThis.__avroModules;
+
+function quote(s) {
+    var out = '"';
+    for (var i = 0; i < s.length; ++i) {
+        var c = s.charAt(i);
+        var code = s.charCodeAt(i);
+        if (c === '"' || c === '\\') {
+            out += '\\' + c;
+        } else if (code < 0x20) {
+            out += '\\' + ('00' + code.toString(8)).slice(-3);
+        } else if (c === '?' && s.charAt(i + 1) === '?') {
+            // Keep trigraphs out of the generated source.
+            out += '?"' + '"';
+        } else {
+            out += c;
+        }
+    }
+    return out + '"';
+}
+
+var SCOPES = {
+    punctuation: 'MATCH_SCOPE_PUNCTUATION',
+    vowel: 'MATCH_SCOPE_VOWEL',
+    consonant: 'MATCH_SCOPE_CONSONANT',
+    exact: 'MATCH_SCOPE_EXACT'
+};
+
+// Normalises a match the same way the js parse() does on first use. Note that the js xors the
+// raw "negative" value, so strings such as "FALSE" behave as false.
+function normaliseMatch(match) {
+    var scope = match.scope;
+    var negative;
+    if (typeof match.negative === 'undefined') {
+        negative = scope.charAt(0) === '!';
+        if (negative) {
+            scope = scope.substring(1);
+        }
+    } else {
+        negative = (match.negative | 0) !== 0;
+    }
+    if (!SCOPES[scope]) {
+        throw new Error('Unknown match scope: ' + match.scope);
+    }
+    return {
+        type: match.type === 'suffix' ? 'MATCH_TYPE_SUFFIX' : 'MATCH_TYPE_PREFIX',
+        scope: SCOPES[scope],
+        negative: negative,
+        value: typeof match.value === 'undefined' ? '' : match.value
+    };
+}
+
+function emitPhoneticData(lines, name, prefix, data, caseSensitive, ignore) {
+    var patterns = data.patterns;
+    patterns.forEach(function(pattern, i) {
+        var rules = pattern.rules || [];
+        rules.forEach(function(rule, j) {
+            lines.push('static const PhoneticMatch ' + prefix + '_MATCHES_' + i + '_' + j
+                    + '[] = {');
+            rule.matches.forEach(function(match) {
+                var m = normaliseMatch(match);
+                lines.push('    { ' + m.type + ', ' + m.scope + ', ' + m.negative + ', '
+                        + quote(m.value) + ' },');
+            });
+            lines.push('};');
+        });
+        if (rules.length > 0) {
+            lines.push('static const PhoneticRule ' + prefix + '_RULES_' + i + '[] = {');
+            rules.forEach(function(rule, j) {
+                var matches = prefix + '_MATCHES_' + i + '_' + j;
+                lines.push('    { ' + matches + ', NELEMS(' + matches + '), '
+                        + quote(rule.replace) + ' },');
+            });
+            lines.push('};');
+        }
+    });
+    lines.push('');
+    lines.push('static const PhoneticPattern ' + prefix + '_PATTERNS[] = {');
+    patterns.forEach(function(pattern, i) {
+        var rules = pattern.rules && pattern.rules.length > 0 ? prefix + '_RULES_' + i : null;
+        lines.push('    { ' + quote(pattern.find) + ', ' + quote(pattern.replace) + ', '
+                + (rules ? rules + ', NELEMS(' + rules + ')' : 'NULL, 0') + ' },');
+    });
+    lines.push('};');
+    lines.push('');
+    lines.push('const PhoneticData ' + name + ' = {');
+    lines.push('    ' + prefix + '_PATTERNS,');
+    lines.push('    NELEMS(' + prefix + '_PATTERNS),');
+    lines.push('    ' + quote(data.vowel) + ',');
+    lines.push('    ' + quote(data.consonant) + ',');
+    lines.push('    ' + quote(caseSensitive) + ',');
+    lines.push('    ' + quote(ignore) + ',');
+    lines.push('};');
+    lines.push('');
+}
+
+// Sorted by the UTF-8 bytes of the key, so the native side can binary search with strcmp.
+function emitStringTable(lines, name, prefix, db) {
+    var keys = Object.keys(db).sort(function(a, b) {
+        return Buffer.compare(Buffer.from(a, 'utf8'), Buffer.from(b, 'utf8'));
+    });
+    lines.push('static const StringPair ' + prefix + '_PAIRS[] = {');
+    keys.forEach(function(key) {
+        lines.push('    { ' + quote(key) + ', ' + quote(db[key]) + ' },');
+    });
+    lines.push('};');
+    lines.push('');
+    lines.push('const StringTable ' + name + ' = { ' + prefix + '_PAIRS, NELEMS(' + prefix
+            + '_PAIRS) };');
+    lines.push('');
+}
+
+function writeFile(name, lines) {
+    var header = [
+        '// Generated by jni/avro/tools/avrodata.js from assets/avro.min.js, do not edit.',
+        '',
+        '#include <cstddef>',
+        ''
+    ];
+    fs.writeFileSync(path.join(outputDir, name), header.concat(lines).join('\n'));
+}
+
+var phonetic = modules.avrolib.OmicronLab.Avro.Phonetic.data;
+var lines = ['#include "phonetic.h"', '', 'namespace avro {', ''];
+emitPhoneticData(lines, 'AVRO_PHONETIC_DATA', 'PHONETIC', phonetic, phonetic.casesensitive, '');
+// avroregexlib lower-cases everything and drops the "ignore" characters instead.
+var regex = new modules.avroregexlib.AvroRegex().data;
+emitPhoneticData(lines, 'AVRO_REGEX_DATA', 'REGEX', regex, '', regex.ignore);
+lines.push('} // namespace avro');
+lines.push('');
+writeFile('phonetic_data.cpp', lines);
+
+lines = ['#include "suggestion_builder.h"', '', 'namespace avro {', ''];
+emitStringTable(lines, 'AVRO_AUTOCORRECT_DATA', 'AUTOCORRECT', modules.autocorrect.db);
+emitStringTable(lines, 'AVRO_SUFFIX_DATA', 'SUFFIX', modules.suffixdict.db);
+lines.push('} // namespace avro');
+lines.push('');
+writeFile('suggestion_data.cpp', lines);
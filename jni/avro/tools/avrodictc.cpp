@@ -0,0 +1,329 @@
+// Compiles the avrodict word tables of assets/avro.min.js into the binary dictionary format
+// described in binary_format.h.
+//
+//   avrodictc assets/avro.min.js assets/avrodict.dict.mp3
+//
+// Built for the host by jni/avro/Makefile, "make -C jni/avro dict" regenerates the asset.
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "binary_format.h"
+#include "utf8.h"
+#include "word_tables.h"
+
+namespace avro {
+namespace {
+
+// Orders word indices by their code points, so that words sharing a prefix end up together.
+class CodePointOrder {
+ public:
+    explicit CodePointOrder(const std::vector<std::vector<int> > *codePoints)
+            : mCodePoints(codePoints) {}
+
+    bool operator()(const int a, const int b) const {
+        const std::vector<int> &left = (*mCodePoints)[a];
+        const std::vector<int> &right = (*mCodePoints)[b];
+        return std::lexicographical_compare(left.begin(), left.end(), right.begin(),
+                right.end());
+    }
+
+ private:
+    const std::vector<std::vector<int> > *mCodePoints;
+};
+
+int getByteCount(const int value) {
+    return value < 0x100 ? 1 : value < 0x10000 ? 2 : 3;
+}
+
+int getGroupCountSize(const std::vector<int> &group) {
+    return group.size() < 0x80 ? 1 : 2;
+}
+
+int getCodePointSize(const int codePoint) {
+    if (codePoint >= BinaryFormat::BENGALI_BLOCK_START
+            && codePoint <= BinaryFormat::BENGALI_BLOCK_END) {
+        return 1;
+    }
+    if (codePoint >= BinaryFormat::MINIMAL_ONE_BYTE_CHARACTER_VALUE
+            && codePoint <= BinaryFormat::MAXIMAL_ASCII_CHARACTER_VALUE) {
+        return 1;
+    }
+    return 3;
+}
+
+void writeInt(const int value, const int size, std::vector<uint8_t> *out) {
+    for (int i = size - 1; i >= 0; --i) {
+        out->push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+void writeCodePoint(const int codePoint, std::vector<uint8_t> *out) {
+    if (codePoint >= BinaryFormat::BENGALI_BLOCK_START
+            && codePoint <= BinaryFormat::BENGALI_BLOCK_END) {
+        out->push_back(static_cast<uint8_t>(BinaryFormat::BENGALI_BYTE_BASE + codePoint
+                - BinaryFormat::BENGALI_BLOCK_START));
+    } else if (getCodePointSize(codePoint) == 1) {
+        out->push_back(static_cast<uint8_t>(codePoint));
+    } else {
+        writeInt(codePoint, 3, out);
+    }
+}
+
+// A char group of the trie under construction. Chains of nodes with a single child and no
+// word are folded into one group with several code points.
+struct CharGroup {
+    CharGroup() : codePoints(), word(NOT_A_WORD), children(), position(0), addressSize(3) {}
+
+    static const int NOT_A_WORD = -1;
+
+    std::vector<int> codePoints;
+    int word;
+    std::vector<int> children;
+    // Where the children position of this group is written, and how many bytes it takes.
+    int position;
+    int addressSize;
+};
+
+class TableWriter {
+ public:
+    explicit TableWriter(const WordTable &table)
+            : mCodePoints(table.words.size()), mGroups(), mRootGroup(), mGroupPositions() {
+        const int wordCount = static_cast<int>(table.words.size());
+        std::vector<int> order(wordCount);
+        for (int i = 0; i < wordCount; ++i) {
+            utf8ToCodePoints(table.words[i], &mCodePoints[i]);
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), CodePointOrder(&mCodePoints));
+        int begin = 0;
+        // The NFA never accepts before reading a code point, so an empty word can't be found.
+        while (begin < wordCount && mCodePoints[order[begin]].empty()) {
+            ++begin;
+        }
+        buildGroup(order, begin, wordCount, 0, &mRootGroup);
+    }
+
+    void write(std::vector<uint8_t> *out) {
+        layout();
+        writeGroup(mRootGroup, out);
+    }
+
+ private:
+    // |order[begin, end)| are the words sharing the |depth| code points leading to |group|.
+    void buildGroup(const std::vector<int> &order, const int begin, const int end,
+            const int depth, std::vector<int> *group) {
+        for (int i = begin; i < end;) {
+            const int codePoint = mCodePoints[order[i]][depth];
+            int groupEnd = i + 1;
+            while (groupEnd < end && mCodePoints[order[groupEnd]][depth] == codePoint) {
+                ++groupEnd;
+            }
+            CharGroup charGroup;
+            int length = depth;
+            int first = i;
+            for (;;) {
+                charGroup.codePoints.push_back(mCodePoints[order[first]][length]);
+                ++length;
+                // Sorting puts the words ending here first. If a word is listed twice, keep the
+                // first one, that is the one the js finds.
+                while (first < groupEnd
+                        && static_cast<int>(mCodePoints[order[first]].size()) == length) {
+                    if (charGroup.word == CharGroup::NOT_A_WORD || order[first] < charGroup.word) {
+                        charGroup.word = order[first];
+                    }
+                    ++first;
+                }
+                if (charGroup.word != CharGroup::NOT_A_WORD || first == groupEnd
+                        || mCodePoints[order[first]][length]
+                                != mCodePoints[order[groupEnd - 1]][length]) {
+                    break;
+                }
+            }
+            buildGroup(order, first, groupEnd, length, &charGroup.children);
+            group->push_back(static_cast<int>(mGroups.size()));
+            mGroups.push_back(charGroup);
+            i = groupEnd;
+        }
+    }
+
+    int getGroupSize(const std::vector<int> &group) const {
+        int size = getGroupCountSize(group);
+        for (size_t i = 0; i < group.size(); ++i) {
+            const CharGroup &charGroup = mGroups[group[i]];
+            ++size;
+            for (size_t j = 0; j < charGroup.codePoints.size(); ++j) {
+                size += getCodePointSize(charGroup.codePoints[j]);
+            }
+            if (charGroup.codePoints.size() > 1) {
+                ++size;
+            }
+            if (charGroup.word != CharGroup::NOT_A_WORD) {
+                size += getByteCount(charGroup.word);
+            }
+            if (!charGroup.children.empty()) {
+                size += charGroup.addressSize;
+            }
+        }
+        return size;
+    }
+
+    // Groups are laid out depth first, each one followed by the groups of its children. Every
+    // children position starts out three bytes wide and is shrunk to fit its distance, until
+    // nothing moves any more.
+    void layout() {
+        for (bool changed = true; changed;) {
+            mGroupPositions.assign(mGroups.size(), 0);
+            int position = 0;
+            placeGroup(mRootGroup, &position);
+            changed = false;
+            for (size_t i = 0; i < mGroups.size(); ++i) {
+                CharGroup *charGroup = &mGroups[i];
+                if (charGroup->children.empty()) {
+                    continue;
+                }
+                const int distance = mGroupPositions[i] - charGroup->position;
+                const int addressSize = getByteCount(distance);
+                if (addressSize != charGroup->addressSize) {
+                    charGroup->addressSize = addressSize;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    // Places |group| at |*position|, records where each of its children positions goes, and
+    // where the groups of its children start.
+    void placeGroup(const std::vector<int> &group, int *position) {
+        int pos = *position + getGroupCountSize(group);
+        *position += getGroupSize(group);
+        for (size_t i = 0; i < group.size(); ++i) {
+            CharGroup *charGroup = &mGroups[group[i]];
+            ++pos;
+            for (size_t j = 0; j < charGroup->codePoints.size(); ++j) {
+                pos += getCodePointSize(charGroup->codePoints[j]);
+            }
+            if (charGroup->codePoints.size() > 1) {
+                ++pos;
+            }
+            if (charGroup->word != CharGroup::NOT_A_WORD) {
+                pos += getByteCount(charGroup->word);
+            }
+            charGroup->position = pos;
+            if (!charGroup->children.empty()) {
+                pos += charGroup->addressSize;
+            }
+        }
+        for (size_t i = 0; i < group.size(); ++i) {
+            if (mGroups[group[i]].children.empty()) {
+                continue;
+            }
+            mGroupPositions[group[i]] = *position;
+            placeGroup(mGroups[group[i]].children, position);
+        }
+    }
+
+    void writeGroup(const std::vector<int> &group, std::vector<uint8_t> *out) const {
+        if (group.size() < 0x80) {
+            writeInt(static_cast<int>(group.size()), 1, out);
+        } else {
+            writeInt(static_cast<int>(group.size()) | 0x8000, 2, out);
+        }
+        for (size_t i = 0; i < group.size(); ++i) {
+            const CharGroup &charGroup = mGroups[group[i]];
+            uint8_t flags = 0;
+            if (!charGroup.children.empty()) {
+                flags |= charGroup.addressSize << 6;
+            }
+            if (charGroup.codePoints.size() > 1) {
+                flags |= BinaryFormat::FLAG_HAS_MULTIPLE_CHARS;
+            }
+            if (charGroup.word != CharGroup::NOT_A_WORD) {
+                flags |= BinaryFormat::FLAG_IS_TERMINAL | getByteCount(charGroup.word);
+            }
+            out->push_back(flags);
+            for (size_t j = 0; j < charGroup.codePoints.size(); ++j) {
+                writeCodePoint(charGroup.codePoints[j], out);
+            }
+            if (charGroup.codePoints.size() > 1) {
+                out->push_back(BinaryFormat::CHARACTER_ARRAY_TERMINATOR);
+            }
+            if (charGroup.word != CharGroup::NOT_A_WORD) {
+                writeInt(charGroup.word, getByteCount(charGroup.word), out);
+            }
+            if (!charGroup.children.empty()) {
+                writeInt(mGroupPositions[group[i]] - charGroup.position, charGroup.addressSize,
+                        out);
+            }
+        }
+        for (size_t i = 0; i < group.size(); ++i) {
+            const CharGroup &charGroup = mGroups[group[i]];
+            if (!charGroup.children.empty()) {
+                writeGroup(charGroup.children, out);
+            }
+        }
+    }
+
+    std::vector<std::vector<int> > mCodePoints;
+    std::vector<CharGroup> mGroups;
+    std::vector<int> mRootGroup;
+    // Where the children of each group start, indexed like |mGroups|.
+    std::vector<int> mGroupPositions;
+};
+
+} // namespace
+} // namespace avro
+
+int main(int argc, char **argv) {
+    using avro::BinaryFormat;
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <avro.min.js> <output.dict>\n", argv[0]);
+        return 2;
+    }
+    std::vector<avro::WordTable> tables;
+    if (!avro::readScriptWordTables(argv[1], &tables)) {
+        return 1;
+    }
+
+    std::vector<std::vector<uint8_t> > bodies(tables.size());
+    int headerSize = BinaryFormat::HEADER_SIZE;
+    int wordCount = 0;
+    for (size_t i = 0; i < tables.size(); ++i) {
+        avro::TableWriter(tables[i]).write(&bodies[i]);
+        headerSize += static_cast<int>(tables[i].name.size()) + 1
+                + BinaryFormat::TABLE_ENTRY_SIZE;
+        wordCount += static_cast<int>(tables[i].words.size());
+    }
+
+    std::vector<uint8_t> header;
+    avro::writeInt(BinaryFormat::MAGIC_NUMBER, 4, &header);
+    avro::writeInt(BinaryFormat::FORMAT_VERSION, 2, &header);
+    avro::writeInt(static_cast<int>(tables.size()), 2, &header);
+    int offset = headerSize;
+    for (size_t i = 0; i < tables.size(); ++i) {
+        header.insert(header.end(), tables[i].name.begin(), tables[i].name.end());
+        header.push_back(BinaryFormat::CHARACTER_ARRAY_TERMINATOR);
+        avro::writeInt(static_cast<int>(tables[i].words.size()), 3, &header);
+        avro::writeInt(offset, 4, &header);
+        avro::writeInt(static_cast<int>(bodies[i].size()), 4, &header);
+        offset += static_cast<int>(bodies[i].size());
+    }
+
+    FILE *file = fopen(argv[2], "wb");
+    if (!file) {
+        fprintf(stderr, "Can't write %s\n", argv[2]);
+        return 1;
+    }
+    bool written = fwrite(&header[0], 1, header.size(), file) == header.size();
+    for (size_t i = 0; written && i < bodies.size(); ++i) {
+        written = fwrite(&bodies[i][0], 1, bodies[i].size(), file) == bodies[i].size();
+    }
+    if (fclose(file) != 0 || !written) {
+        fprintf(stderr, "Can't write %s\n", argv[2]);
+        return 1;
+    }
+    printf("%s: %d tables, %d words, %d bytes\n", argv[2], static_cast<int>(tables.size()),
+            wordCount, offset);
+    return 0;
+}
@@ -0,0 +1,101 @@
+// Checks that BatchParser gives the same output as parsing the text line by line, whatever the
+// thread count and wherever the chunk boundaries fall.
+//
+//   batch_parser_test
+//
+// Built for the host by jni/avro/Makefile, "make -C jni/avro test" runs it.
+
+#include <stdint.h>
+#include <cstdio>
+#include <string>
+
+#include "batch_parser.h"
+#include "phonetic.h"
+
+namespace {
+
+int failures = 0;
+
+void parseByLine(const avro::PhoneticParser &parser, const std::string &text,
+        std::string *output) {
+    std::string parsed;
+    output->clear();
+    for (size_t begin = 0; begin < text.size();) {
+        const size_t newline = text.find('\n', begin);
+        const size_t lineEnd = newline == std::string::npos ? text.size() : newline;
+        parser.parse(text.substr(begin, lineEnd - begin), &parsed);
+        output->append(parsed);
+        if (newline == std::string::npos) {
+            break;
+        }
+        output->push_back('\n');
+        begin = newline + 1;
+    }
+}
+
+void expectSameOutput(const avro::PhoneticParser &parser, const std::string &text,
+        const char *what) {
+    static const int THREAD_COUNTS[] = { 1, 2, 4, 8 };
+    std::string expected;
+    parseByLine(parser, text, &expected);
+    for (size_t i = 0; i < NELEMS(THREAD_COUNTS); ++i) {
+        avro::BatchParser batchParser(&parser, THREAD_COUNTS[i]);
+        std::string output;
+        batchParser.parse(text.data(), text.size(), &output);
+        if (output != expected) {
+            fprintf(stderr, "FAIL: %s differs from the line by line output on %d threads\n",
+                    what, THREAD_COUNTS[i]);
+            ++failures;
+        }
+    }
+}
+
+// Roman words and punctuation, with the odd empty line.
+void appendRandomLines(const size_t length, std::string *text) {
+    static const char *const WORDS[] = {
+        "ami", "bangla", "gan", "gai", "kOrechi", "rrito", "ShomaeSh", "123", ",", "?", "",
+    };
+    static uint32_t random = 12345;
+    const size_t end = text->size() + length;
+    while (text->size() < end) {
+        random = random * 1103515245 + 12345;
+        const uint32_t value = random >> 8;
+        text->append(WORDS[value % NELEMS(WORDS)]);
+        text->push_back(value % 7 == 0 ? '\n' : ' ');
+    }
+}
+
+void testTexts() {
+    const avro::PhoneticParser parser(&avro::AVRO_PHONETIC_DATA);
+    expectSameOutput(parser, "", "an empty text");
+    expectSameOutput(parser, "\n\n", "a text of line ends");
+    expectSameOutput(parser, "ami banglay gan gai", "a line without a line end");
+
+    // Several chunks' worth, ending with and without a line end.
+    std::string text;
+    appendRandomLines(1024 * 1024, &text);
+    text.push_back('\n');
+    expectSameOutput(parser, text, "a text of many chunks");
+    text.append("ses");
+    expectSameOutput(parser, text, "a text of many chunks without a last line end");
+
+    // A line longer than a chunk, which the chunk has to stretch to hold.
+    std::string longLine;
+    while (longLine.size() < 200 * 1024) {
+        longLine.append("amar sOnar bangla ");
+    }
+    expectSameOutput(parser, "ami\n" + longLine + "\ntumi\n", "a line longer than a chunk");
+    expectSameOutput(parser, longLine, "a single line longer than a chunk");
+}
+
+} // namespace
+
+int main() {
+    testTexts();
+    if (failures) {
+        fprintf(stderr, "%d failures\n", failures);
+        return 1;
+    }
+    printf("batch_parser_test: OK\n");
+    return 0;
+}
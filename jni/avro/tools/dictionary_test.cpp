@@ -0,0 +1,74 @@
+// Checks the native dictionary search against what dbsearch returns for the same input.
+//
+//   dictionary_test <avrodict.dict>
+//
+// Built for the host by jni/avro/Makefile, "make -C jni/avro test" runs it on the dictionary
+// in assets.
+
+#include <sys/stat.h>
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "dictionary.h"
+
+namespace {
+
+int failures = 0;
+
+std::string join(const std::vector<std::string> &words) {
+    std::string joined;
+    for (size_t i = 0; i < words.size(); ++i) {
+        joined += (i ? " " : "") + words[i];
+    }
+    return joined;
+}
+
+void expect(const bool condition, const char *what, const std::string &input) {
+    if (!condition) {
+        fprintf(stderr, "FAIL: %s for \"%s\"\n", what, input.c_str());
+        ++failures;
+    }
+}
+
+// dbsearch picks the tables by the lowercased first letter, so an uppercase one still finds words.
+void testMixedCaseInitial(avro::Dictionary *dictionary) {
+    static const char *const INPUTS[][2] = {
+        { "A", "a" }, { "O", "o" }, { "SMN", "smn" }, { "Ami", "ami" }, { "aMi", "ami" },
+    };
+    std::vector<std::string> words;
+    std::vector<std::string> lowerWords;
+    for (size_t i = 0; i < sizeof(INPUTS) / sizeof(INPUTS[0]); ++i) {
+        dictionary->search(INPUTS[i][0], &words);
+        dictionary->search(INPUTS[i][1], &lowerWords);
+        expect(!words.empty(), "no words", INPUTS[i][0]);
+        expect(join(words) == join(lowerWords), "not the words of the lowercase input",
+                INPUTS[i][0]);
+    }
+    dictionary->search("Ami", &words);
+    expect(std::find(words.begin(), words.end(), "\xe0\xa6\x86\xe0\xa6\xae\xe0\xa6\xbf")
+            != words.end(), "no \"ami\" word", "Ami");
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <avrodict.dict>\n", argv[0]);
+        return 2;
+    }
+    struct stat st;
+    avro::Dictionary dictionary;
+    if (stat(argv[1], &st) != 0 || !dictionary.open(argv[1], 0, st.st_size)) {
+        fprintf(stderr, "Can't open %s\n", argv[1]);
+        return 2;
+    }
+    testMixedCaseInitial(&dictionary);
+    if (failures) {
+        fprintf(stderr, "%d failures\n", failures);
+        return 1;
+    }
+    printf("dictionary_test: OK\n");
+    return 0;
+}
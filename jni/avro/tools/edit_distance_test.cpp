@@ -0,0 +1,127 @@
+// Checks the bit-parallel EditDistance against the plain optimal string alignment table on
+// random pairs of words.
+//
+//   edit_distance_test [pairs]
+//
+// Built for the host by jni/avro/Makefile, "make -C jni/avro test" runs it.
+
+#include <stdint.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "edit_distance.h"
+
+namespace {
+
+int failures = 0;
+
+// The js levenshtein() written out as a table, which EditDistance must agree with.
+int getDistanceByTable(const std::vector<int> &a, const std::vector<int> &b) {
+    const int n = static_cast<int>(a.size());
+    const int m = static_cast<int>(b.size());
+    const int width = m + 1;
+    std::vector<int> d((n + 1) * width);
+    for (int i = 0; i <= n; ++i) {
+        d[i * width] = i;
+    }
+    for (int j = 0; j <= m; ++j) {
+        d[j] = j;
+    }
+    for (int i = 1; i <= n; ++i) {
+        for (int j = 1; j <= m; ++j) {
+            const int cost = a[i - 1] == b[j - 1] ? 0 : 1;
+            int distance = std::min(d[(i - 1) * width + j], d[i * width + j - 1]) + 1;
+            distance = std::min(distance, d[(i - 1) * width + j - 1] + cost);
+            if (i > 1 && j > 1 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1]) {
+                distance = std::min(distance, d[(i - 2) * width + j - 2] + cost);
+            }
+            d[i * width + j] = distance;
+        }
+    }
+    return d[n * width + m];
+}
+
+// A fixed sequence, so that a failure can be reproduced.
+uint32_t nextRandom() {
+    static uint32_t state = 12345;
+    state = state * 1103515245 + 12345;
+    return state >> 8;
+}
+
+// Few distinct code points, so that words share characters and transpose them often. They
+// come from ascii, the Bengali block and beyond, which EditDistance keeps masks for apart.
+int getRandomCodePoint() {
+    static const int CODE_POINTS[] = {
+        'a', 'b', 'c', 0x0995, 0x09BE, 0x09CD, 0x0985, 0x200C, 0x1F600,
+    };
+    return CODE_POINTS[nextRandom() % NELEMS(CODE_POINTS)];
+}
+
+// Mostly candidate sized, sometimes over the 64 code points the bit-parallel pass handles.
+void getRandomWord(std::vector<int> *word) {
+    const int length = nextRandom() % 8 == 0 ? nextRandom() % 80 : nextRandom() % 12;
+    word->resize(length);
+    for (int i = 0; i < length; ++i) {
+        (*word)[i] = getRandomCodePoint();
+    }
+}
+
+void expectDistance(avro::EditDistance *editDistance, const std::vector<int> &pattern,
+        const std::vector<int> &word) {
+    const int expected = getDistanceByTable(pattern, word);
+    const int distance = editDistance->getDistance(word);
+    if (distance != expected) {
+        fprintf(stderr, "FAIL: distance %d instead of %d between %d and %d code points\n",
+                distance, expected, static_cast<int>(pattern.size()),
+                static_cast<int>(word.size()));
+        ++failures;
+    }
+}
+
+std::vector<int> toCodePoints(const char *s) {
+    return std::vector<int>(s, s + strlen(s));
+}
+
+void testKnownPairs() {
+    static const char *const PAIRS[][2] = {
+        { "", "" }, { "", "abc" }, { "abc", "" }, { "ab", "ba" }, { "ca", "abc" },
+        { "kitten", "sitting" }, { "abcdef", "badcfe" },
+    };
+    avro::EditDistance editDistance;
+    for (size_t i = 0; i < NELEMS(PAIRS); ++i) {
+        editDistance.setPattern(toCodePoints(PAIRS[i][0]));
+        expectDistance(&editDistance, toCodePoints(PAIRS[i][0]), toCodePoints(PAIRS[i][1]));
+    }
+}
+
+// A pattern is measured against several words, as the candidates of a keystroke are.
+void testRandomPairs(const int pairCount) {
+    avro::EditDistance editDistance;
+    std::vector<int> pattern;
+    std::vector<int> word;
+    for (int i = 0; i < pairCount; ++i) {
+        if (i % 8 == 0) {
+            getRandomWord(&pattern);
+            editDistance.setPattern(pattern);
+        }
+        getRandomWord(&word);
+        expectDistance(&editDistance, pattern, word);
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const int pairCount = argc > 1 ? atoi(argv[1]) : 300000;
+    testKnownPairs();
+    testRandomPairs(pairCount);
+    if (failures) {
+        fprintf(stderr, "%d failures\n", failures);
+        return 1;
+    }
+    printf("edit_distance_test: OK\n");
+    return 0;
+}
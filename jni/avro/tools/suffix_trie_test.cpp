@@ -0,0 +1,115 @@
+// Checks that SuffixTrie finds the same suffix splits as looking up every tail of the input in
+// the table, the way the js _addSuffix() does.
+//
+//   suffix_trie_test
+//
+// Built for the host by jni/avro/Makefile, "make -C jni/avro test" runs it.
+
+#include <stdint.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "suffix_trie.h"
+#include "suggestion_builder.h"
+
+namespace {
+
+int failures = 0;
+
+// Shortest suffix first, as findSuffixes() returns them.
+void findSuffixesByLookup(const avro::StringTable &table, const std::string &text,
+        std::vector<avro::SuffixMatch> *matches) {
+    matches->clear();
+    for (int start = static_cast<int>(text.size()) - 1; start > 0; --start) {
+        const char *value = avro::findString(table, text.substr(start));
+        if (value) {
+            const avro::SuffixMatch match = { start, value };
+            matches->push_back(match);
+        }
+    }
+}
+
+void expectSameSuffixes(const avro::StringTable &table, const avro::SuffixTrie &trie,
+        const std::string &text) {
+    std::vector<avro::SuffixMatch> matches;
+    std::vector<avro::SuffixMatch> expected;
+    trie.findSuffixes(text, &matches);
+    findSuffixesByLookup(table, text, &expected);
+    bool same = matches.size() == expected.size();
+    for (size_t i = 0; same && i < matches.size(); ++i) {
+        same = matches[i].start == expected[i].start && matches[i].value == expected[i].value;
+    }
+    if (!same) {
+        fprintf(stderr, "FAIL: %d suffixes instead of %d for \"%s\"\n",
+                static_cast<int>(matches.size()), static_cast<int>(expected.size()),
+                text.c_str());
+        ++failures;
+    }
+}
+
+// Keys nested in each other, and one that takes the whole text and must not be split off.
+void testNestedKeys() {
+    static const avro::StringPair PAIRS[] = {
+        { "a", "1" }, { "ba", "2" }, { "cba", "3" }, { "dcba", "4" }, { "xa", "5" },
+    };
+    const avro::StringTable table = { PAIRS, NELEMS(PAIRS) };
+    const avro::SuffixTrie trie(&table);
+    static const char *const TEXTS[] = {
+        "", "a", "ba", "dcba", "edcba", "xba", "xa", "axa", "b", "ab", "cbax",
+    };
+    for (size_t i = 0; i < NELEMS(TEXTS); ++i) {
+        expectSameSuffixes(table, trie, TEXTS[i]);
+    }
+    std::vector<avro::SuffixMatch> matches;
+    trie.findSuffixes("edcba", &matches);
+    if (matches.size() != 4 || matches[0].start != 4 || matches[3].start != 1) {
+        fprintf(stderr, "FAIL: \"edcba\" is not split after each of its first four letters\n");
+        ++failures;
+    }
+}
+
+// Every suffix of the js suffixdict after a few stems, and random texts made of the letters
+// the suffixes are made of.
+void testSuffixTable() {
+    const avro::StringTable &table = avro::AVRO_SUFFIX_DATA;
+    const avro::SuffixTrie trie(&table);
+    static const char *const STEMS[] = { "", "a", "ami", "bangla", "kor" };
+    for (int i = 0; i < table.count; ++i) {
+        for (size_t j = 0; j < NELEMS(STEMS); ++j) {
+            expectSameSuffixes(table, trie, std::string(STEMS[j]) + table.pairs[i].key);
+        }
+    }
+    std::string letters;
+    for (int i = 0; i < table.count; ++i) {
+        for (const char *c = table.pairs[i].key; *c; ++c) {
+            if (letters.find(*c) == std::string::npos) {
+                letters += *c;
+            }
+        }
+    }
+    uint32_t random = 12345;
+    std::string text;
+    for (int i = 0; i < 100000; ++i) {
+        random = random * 1103515245 + 12345;
+        text.resize((random >> 8) % 12);
+        for (size_t j = 0; j < text.size(); ++j) {
+            random = random * 1103515245 + 12345;
+            text[j] = letters[(random >> 8) % letters.size()];
+        }
+        expectSameSuffixes(table, trie, text);
+    }
+}
+
+} // namespace
+
+int main() {
+    testNestedKeys();
+    testSuffixTable();
+    if (failures) {
+        fprintf(stderr, "%d failures\n", failures);
+        return 1;
+    }
+    printf("suffix_trie_test: OK\n");
+    return 0;
+}
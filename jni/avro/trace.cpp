@@ -0,0 +1,142 @@
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#include <cstdio>
+
+#include "trace.h"
+
+namespace avro {
+
+namespace {
+
+// A power of two, so the ring index is a mask of the event count.
+const uint32_t RING_SIZE = 8192;
+
+// |sequence| is 0 while the event is being written and its index in the ring plus one once it
+// is complete, so the dump can tell a finished event from one a writer is still filling in.
+struct TraceEvent {
+    volatile uint32_t sequence;
+    int tid;
+    const char *name;
+    int64_t start;
+    int64_t duration;
+};
+
+TraceEvent ring[RING_SIZE];
+volatile uint32_t eventCount = 0;
+// Events before this one were dropped by clear().
+volatile uint32_t firstEvent = 0;
+
+// The thread id is asked of the kernel once per thread, and kept in a key after that.
+pthread_key_t threadIdKey;
+pthread_once_t threadIdKeyOnce = PTHREAD_ONCE_INIT;
+
+void createThreadIdKey() {
+    pthread_key_create(&threadIdKey, NULL);
+}
+
+int getThreadId() {
+    pthread_once(&threadIdKeyOnce, createThreadIdKey);
+    const intptr_t tid = reinterpret_cast<intptr_t>(pthread_getspecific(threadIdKey));
+    if (tid) {
+        return static_cast<int>(tid);
+    }
+    const int newTid = static_cast<int>(syscall(__NR_gettid));
+    pthread_setspecific(threadIdKey, reinterpret_cast<void *>(static_cast<intptr_t>(newTid)));
+    return newTid;
+}
+
+void appendEscaped(const char *s, std::string *out) {
+    for (; *s; ++s) {
+        if (*s == '"' || *s == '\\') {
+            out->push_back('\\');
+        }
+        out->push_back(*s);
+    }
+}
+
+} // namespace
+
+volatile bool Trace::sEnabled = false;
+
+void Trace::setEnabled(const bool enabled) {
+    sEnabled = enabled;
+    __sync_synchronize();
+}
+
+int64_t Trace::now() {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<int64_t>(time.tv_sec) * 1000000000 + time.tv_nsec;
+}
+
+void Trace::record(const char *name, const int64_t start, const int64_t end) {
+    const uint32_t index = __sync_fetch_and_add(&eventCount, 1);
+    TraceEvent &event = ring[index & (RING_SIZE - 1)];
+    event.sequence = 0;
+    __sync_synchronize();
+    event.tid = getThreadId();
+    event.name = name;
+    event.start = start;
+    event.duration = end - start;
+    __sync_synchronize();
+    event.sequence = index + 1;
+}
+
+void Trace::clear() {
+    firstEvent = eventCount;
+}
+
+void Trace::dump(std::string *json) {
+    const uint32_t end = eventCount;
+    uint32_t begin = end > RING_SIZE ? end - RING_SIZE : 0;
+    if (end - firstEvent < end - begin) {
+        begin = firstEvent;
+    }
+    const int pid = static_cast<int>(getpid());
+    json->assign("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    bool first = true;
+    char buffer[160];
+    for (uint32_t index = begin; index != end; ++index) {
+        const TraceEvent &slot = ring[index & (RING_SIZE - 1)];
+        const uint32_t sequence = slot.sequence;
+        __sync_synchronize();
+        const TraceEvent event = { sequence, slot.tid, slot.name, slot.start, slot.duration };
+        __sync_synchronize();
+        // Still being written, or overwritten by a newer event while being read.
+        if (sequence != index + 1 || slot.sequence != sequence) {
+            continue;
+        }
+        json->append(first ? "{\"name\":\"" : ",{\"name\":\"");
+        first = false;
+        appendEscaped(event.name, json);
+        // Timestamps are in microseconds.
+        snprintf(buffer, sizeof(buffer),
+                "\",\"cat\":\"avro\",\"ph\":\"X\",\"ts\":%lld.%03d,\"dur\":%lld.%03d,"
+                "\"pid\":%d,\"tid\":%d}",
+                static_cast<long long>(event.start / 1000), static_cast<int>(event.start % 1000),
+                static_cast<long long>(event.duration / 1000),
+                static_cast<int>(event.duration % 1000), pid, event.tid);
+        json->append(buffer);
+    }
+    json->append("]}\n");
+}
+
+bool Trace::dumpToFile(const char *path) {
+    std::string json;
+    dump(&json);
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        AVRO_LOGE("Can't write trace to %s", path);
+        return false;
+    }
+    const bool written = fwrite(json.data(), 1, json.size(), file) == json.size();
+    if (fclose(file) != 0 || !written) {
+        AVRO_LOGE("Can't write trace to %s", path);
+        return false;
+    }
+    return true;
+}
+
+} // namespace avro
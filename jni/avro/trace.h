@@ -0,0 +1,76 @@
+#ifndef AVRO_TRACE_H
+#define AVRO_TRACE_H
+
+#include <stdint.h>
+#include <string>
+
+#include "defines.h"
+
+// Spans are compiled in unless built with -DAVRO_TRACE_ENABLED=0, and only recorded once
+// Trace::setEnabled(true) is called, so a disabled span costs a load and a branch.
+#ifndef AVRO_TRACE_ENABLED
+#define AVRO_TRACE_ENABLED 1
+#endif
+
+#if AVRO_TRACE_ENABLED
+#define AVRO_TRACE_CONCAT_INNER(a, b) a##b
+#define AVRO_TRACE_CONCAT(a, b) AVRO_TRACE_CONCAT_INNER(a, b)
+// Records the time from here to the end of the enclosing scope. |name| has to be a literal.
+#define AVRO_TRACE(name) avro::TraceSpan AVRO_TRACE_CONCAT(traceSpan, __LINE__)(name)
+#else // AVRO_TRACE_ENABLED
+#define AVRO_TRACE(name)
+#endif // AVRO_TRACE_ENABLED
+
+namespace avro {
+
+// Where the time of a keystroke goes, across the JNI bridge, V8 and the engine. Spans are
+// kept in a fixed ring of the last RING_SIZE, which any thread records into without a lock,
+// and are dumped in the Chrome trace event format that chrome://tracing and Perfetto load.
+class Trace {
+ public:
+    static void setEnabled(const bool enabled);
+    static bool isEnabled() {
+        return sEnabled;
+    }
+
+    // Monotonic, in nanoseconds.
+    static int64_t now();
+    static void record(const char *name, const int64_t start, const int64_t end);
+    static void clear();
+
+    // The spans still in the ring, oldest first, as a JSON object.
+    static void dump(std::string *json);
+    static bool dumpToFile(const char *path);
+
+ private:
+    DISALLOW_IMPLICIT_CONSTRUCTORS(Trace);
+
+    static volatile bool sEnabled;
+};
+
+class TraceSpan {
+ public:
+    explicit TraceSpan(const char *name)
+            : mName(Trace::isEnabled() ? name : NULL), mStart(mName ? Trace::now() : 0) {}
+
+    ~TraceSpan() {
+        finish();
+    }
+
+    // Ends the span before the scope does, for timing what can't be put in a scope of its own.
+    void finish() {
+        if (mName) {
+            Trace::record(mName, mStart, Trace::now());
+            mName = NULL;
+        }
+    }
+
+ private:
+    DISALLOW_IMPLICIT_CONSTRUCTORS(TraceSpan);
+
+    const char *mName;
+    const int64_t mStart;
+};
+
+} // namespace avro
+#endif // AVRO_TRACE_H
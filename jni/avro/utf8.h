@@ -0,0 +1,74 @@
+#ifndef AVRO_UTF8_H
+#define AVRO_UTF8_H
+
+#include <string>
+#include <vector>
+
+namespace avro {
+
+// Decodes the code point starting at |*pos| and advances |*pos| past it. Malformed bytes are
+// returned one at a time so that nothing is ever dropped.
+inline int decodeUtf8(const char *s, const int length, int *pos) {
+    const unsigned char c = static_cast<unsigned char>(s[*pos]);
+    int extra;
+    int codePoint;
+    if (c < 0x80) {
+        ++*pos;
+        return c;
+    } else if ((c & 0xE0) == 0xC0) {
+        extra = 1;
+        codePoint = c & 0x1F;
+    } else if ((c & 0xF0) == 0xE0) {
+        extra = 2;
+        codePoint = c & 0x0F;
+    } else if ((c & 0xF8) == 0xF0) {
+        extra = 3;
+        codePoint = c & 0x07;
+    } else {
+        ++*pos;
+        return c;
+    }
+    if (*pos + extra >= length) {
+        ++*pos;
+        return c;
+    }
+    for (int i = 1; i <= extra; ++i) {
+        const unsigned char next = static_cast<unsigned char>(s[*pos + i]);
+        if ((next & 0xC0) != 0x80) {
+            ++*pos;
+            return c;
+        }
+        codePoint = (codePoint << 6) | (next & 0x3F);
+    }
+    *pos += extra + 1;
+    return codePoint;
+}
+
+inline void appendUtf8(const int codePoint, std::string *out) {
+    if (codePoint < 0x80) {
+        out->push_back(static_cast<char>(codePoint));
+    } else if (codePoint < 0x800) {
+        out->push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        out->push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else if (codePoint < 0x10000) {
+        out->push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        out->push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else {
+        out->push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        out->push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+inline void utf8ToCodePoints(const std::string &s, std::vector<int> *out) {
+    out->clear();
+    const int length = static_cast<int>(s.size());
+    for (int pos = 0; pos < length;) {
+        out->push_back(decodeUtf8(s.data(), length, &pos));
+    }
+}
+
+} // namespace avro
+#endif // AVRO_UTF8_H
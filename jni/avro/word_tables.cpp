@@ -0,0 +1,157 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "defines.h"
+#include "utf8.h"
+#include "word_tables.h"
+
+namespace avro {
+
+static const char *const AVRODICT_MARKER = "h=\"avrodict\";p({tables:{";
+static const char *const SPLIT_CALL = ".split(\" \")";
+
+static bool readFile(const char *path, std::string *contents) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+    fseek(file, 0, SEEK_END);
+    const long size = ftell(file);
+    rewind(file);
+    if (size < 0) {
+        fclose(file);
+        return false;
+    }
+    contents->resize(size);
+    const size_t read = size > 0 ? fread(&(*contents)[0], 1, size, file) : 0;
+    fclose(file);
+    return read == static_cast<size_t>(size);
+}
+
+// Reads the js string literal at |*pos|, handling the escapes a minifier emits.
+static bool readStringLiteral(const std::string &s, size_t *pos, std::string *out) {
+    const char quote = s[*pos];
+    out->clear();
+    for (++*pos; *pos < s.size(); ++*pos) {
+        const char c = s[*pos];
+        if (c == quote) {
+            ++*pos;
+            return true;
+        }
+        if (c != '\\') {
+            out->push_back(c);
+            continue;
+        }
+        if (++*pos >= s.size()) {
+            return false;
+        }
+        const char escaped = s[*pos];
+        switch (escaped) {
+        case 'n':
+            out->push_back('\n');
+            break;
+        case 't':
+            out->push_back('\t');
+            break;
+        case 'r':
+            out->push_back('\r');
+            break;
+        case 'u':
+        case 'x': {
+            const size_t digits = escaped == 'u' ? 4 : 2;
+            if (*pos + digits >= s.size()) {
+                return false;
+            }
+            const std::string hex = s.substr(*pos + 1, digits);
+            appendUtf8(static_cast<int>(strtol(hex.c_str(), NULL, 16)), out);
+            *pos += digits;
+            break;
+        }
+        default:
+            out->push_back(escaped);
+            break;
+        }
+    }
+    return false;
+}
+
+// The minifier wraps long lines between tokens.
+static void skipWhitespace(const std::string &s, size_t *pos) {
+    while (*pos < s.size() && (s[*pos] == '\n' || s[*pos] == '\r' || s[*pos] == ' ')) {
+        ++*pos;
+    }
+}
+
+static void splitOnSpace(const std::string &s, std::vector<std::string> *words) {
+    size_t start = 0;
+    for (;;) {
+        const size_t space = s.find(' ', start);
+        words->push_back(s.substr(start, space == std::string::npos ? space : space - start));
+        if (space == std::string::npos) {
+            return;
+        }
+        start = space + 1;
+    }
+}
+
+bool readScriptWordTables(const char *path, std::vector<WordTable> *tables) {
+    std::string script;
+    if (!readFile(path, &script)) {
+        AVRO_LOGE("Can't read %s", path);
+        return false;
+    }
+    size_t pos = script.find(AVRODICT_MARKER);
+    if (pos == std::string::npos) {
+        AVRO_LOGE("No avrodict tables in %s", path);
+        return false;
+    }
+    pos += strlen(AVRODICT_MARKER);
+    tables->clear();
+    std::string literal;
+    skipWhitespace(script, &pos);
+    while (pos < script.size() && script[pos] != '}') {
+        const size_t colon = script.find(':', pos);
+        if (colon == std::string::npos) {
+            return false;
+        }
+        tables->push_back(WordTable());
+        WordTable *table = &tables->back();
+        table->name = script.substr(pos, colon - pos);
+        pos = colon + 1;
+        if (script[pos] == '"' || script[pos] == '\'') {
+            // w_a:"অ অংক ...".split(" ")
+            if (!readStringLiteral(script, &pos, &literal)
+                    || script.compare(pos, strlen(SPLIT_CALL), SPLIT_CALL) != 0) {
+                return false;
+            }
+            pos += strlen(SPLIT_CALL);
+            splitOnSpace(literal, &table->words);
+        } else if (script[pos] == '[') {
+            // w_khandatta:["ৎ"]
+            ++pos;
+            while (pos < script.size() && script[pos] != ']') {
+                if (!readStringLiteral(script, &pos, &literal)) {
+                    return false;
+                }
+                table->words.push_back(literal);
+                skipWhitespace(script, &pos);
+                if (script[pos] == ',') {
+                    ++pos;
+                }
+                skipWhitespace(script, &pos);
+            }
+            ++pos;
+        } else {
+            return false;
+        }
+        skipWhitespace(script, &pos);
+        if (pos < script.size() && script[pos] == ',') {
+            ++pos;
+        }
+        skipWhitespace(script, &pos);
+    }
+    return !tables->empty();
+}
+
+} // namespace avro
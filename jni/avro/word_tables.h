@@ -0,0 +1,22 @@
+#ifndef AVRO_WORD_TABLES_H
+#define AVRO_WORD_TABLES_H
+
+#include <string>
+#include <vector>
+
+namespace avro {
+
+// One "w_*" table of the avrodict module, words in the order the js lists them.
+struct WordTable {
+    WordTable() : name(), words() {}
+
+    std::string name;
+    std::vector<std::string> words;
+};
+
+// Reads the avrodict word tables out of assets/avro.min.js, where they are stored as
+// space separated string literals.
+bool readScriptWordTables(const char *path, std::vector<WordTable> *tables);
+
+} // namespace avro
+#endif // AVRO_WORD_TABLES_H
@@ -4,38 +4,90 @@
 #include <string>
 #include <stdio.h>
 #include <android/log.h>
+#include <vector>
+#include "avro/dictionary.h"
+#include "avro/suggestion_builder.h"
+#include "avro/suggestion_worker.h"
+#include "avro/trace.h"
 #define  LOGI(...)  __android_log_print(ANDROID_LOG_INFO,"avro-ndk",__VA_ARGS__)
 #define  LOGIJS(...)  __android_log_print(ANDROID_LOG_INFO,"avro-js",__VA_ARGS__)
 
 using namespace v8;
 
-HandleScope handle_scope;
-
 std::string libdir;
 
 // Create a new context.
 Persistent<Context> context;
+
+// Looked up once the scripts are loaded rather than on every keystroke. Each call then only
+// needs a HandleScope of its own, so its handles are gone by the time it returns.
+Persistent<Object> avroglobal;
+// avroparsefunc, and avroparse, the AvroForGaia instance from avro.init.js.
+Persistent<Function> avroparsefunc;
+Persistent<Function> avrosuggestfunc;
+
+// Native index of the avrodict word tables.
+avro::Dictionary dictionary;
+
+// Native port of the js SuggestionBuilder, used once the dictionary is loaded.
+avro::SuggestionBuilder suggestionBuilder(&dictionary);
+
+// UTF-16 chars going in and out of V8, kept around so keystrokes don't allocate.
+std::vector<uint16_t> jsbuffer;
 	
-Handle<String> ReadFile(const char* name) {
+bool ReadFile(const char* name, std::string& content) {
   FILE* file = fopen(name, "rb");
-  if (file == NULL) return Handle<String>();
+  if (file == NULL) return false;
 
   fseek(file, 0, SEEK_END);
   int size = ftell(file);
   rewind(file);
 
-  char* chars = new char[size + 1];
-  chars[size] = '\0';
+  content.resize(size);
   for (int i = 0; i < size;) {
-    int read = fread(&chars[i], 1, size - i, file);
+    int read = fread(&content[i], 1, size - i, file);
+    if (read <= 0) break;
     i += read;
   }
   fclose(file);
-  Handle<String> result = String::New(chars, size);
-  delete[] chars;
-  return result;
+  return true;
+}
+
+// Preparse data of a script is cached next to it as <name>.cache. The first line holds the V8
+// version and a hash of the script, the cache is only used while both still match.
+std::string ScriptCacheHeader(const std::string& content) {
+  // FNV-1a
+  unsigned int hash = 2166136261u;
+  for (size_t i = 0; i < content.size(); i++) {
+    hash = (hash ^ (unsigned char)content[i]) * 16777619u;
+  }
+  char header[128];
+  snprintf(header, sizeof(header), "%s %08x %u\n", V8::GetVersion(), hash, (unsigned int)content.size());
+  return header;
 }
 
+// The returned ScriptData may point into |cache| instead of copying it, so |cache| has to outlive
+// it and stay unmodified until it is deleted.
+ScriptData* LoadScriptCache(const std::string& cachepath, const std::string& header,
+                            std::string& cache) {
+  if (!ReadFile(cachepath.c_str(), cache) || cache.compare(0, header.size(), header) != 0) {
+    return NULL;
+  }
+  ScriptData* pre_data = ScriptData::New(cache.data() + header.size(), cache.size() - header.size());
+  if (pre_data->HasError()) {
+    delete pre_data;
+    return NULL;
+  }
+  return pre_data;
+}
+
+void SaveScriptCache(const std::string& cachepath, const std::string& header, ScriptData* pre_data) {
+  FILE* file = fopen(cachepath.c_str(), "wb");
+  if (file == NULL) return;
+  fwrite(header.data(), 1, header.size(), file);
+  fwrite(pre_data->Data(), 1, pre_data->Length(), file);
+  fclose(file);
+}
 
 const char* ToCString(const String::Utf8Value& value) {
   return *value ? *value : "<string conversion failed>";
@@ -59,28 +111,136 @@ Handle<Value> Print(const Arguments& args) {
 
 
 void loadfile(std::string filename){
+    AVRO_TRACE("loadfile");
+    HandleScope handle_scope;
     Context::Scope context_scope(context);
 	LOGI("Loading js file : %s",filename.c_str());
 
     std::string filepath = libdir + filename;
+    std::string content;
+    if (!ReadFile(filepath.c_str(), content)) {
+        LOGI("Can't read js file : %s",filepath.c_str());
+        return;
+    }
     // Create a string containing the JavaScript source code.
-    Handle<String> source = ReadFile(filepath.c_str());
+    Handle<String> source = String::New(content.data(), content.size());
+
+    // Hand the preparse data of the last run to the compiler instead of preparsing 3.8 MB again.
+    std::string cachepath = filepath + ".cache";
+    std::string header = ScriptCacheHeader(content);
+    // Kept until pre_data is deleted, which may be reading from it.
+    std::string cache;
+    ScriptData* pre_data = LoadScriptCache(cachepath, header, cache);
+    if (pre_data != NULL) {
+        LOGI("Using script cache : %s",cachepath.c_str());
+    } else {
+        pre_data = ScriptData::PreCompile(content.data(), content.size());
+        if (!pre_data->HasError()) {
+            SaveScriptCache(cachepath, header, pre_data);
+            LOGI("Saved script cache : %s",cachepath.c_str());
+        }
+    }
     // Compile the source code.
-    Handle<Script> script = Script::Compile(source);
+    avro::TraceSpan compile_span("v8.compile");
+    Handle<Script> script = Script::Compile(source, NULL, pre_data);
+    delete pre_data;
+    compile_span.finish();
 	
+	AVRO_TRACE("v8.run");
 	script->Run();
 	LOGI("Finished Loding file.");
 	
 }
 
+// True when avroparsefunc is already defined, ie the context was deserialized from a snapshot
+// made with "mksnapshot.sh avro".
+bool IsAvroLoaded(){
+    HandleScope handle_scope;
+    Context::Scope context_scope(context);
+    return context->Global()->Get(String::New("avroparsefunc"))->IsFunction();
+}
+
+// The defaults are sized for a browser. The IME keeps little besides the scripts, the 3.8 MB of
+// dictionary strings and the garbage of a keystroke, so the young generation is kept small enough
+// for a scavenge to fit between two keystrokes, and the old one is capped well below the app's
+// heap limit. In bytes, and only taken into account before V8 is initialized.
+const int kMaxYoungSpaceSize = 2 * 1024 * 1024;
+const int kMaxOldSpaceSize = 64 * 1024 * 1024;
+const int kMaxExecutableSize = 16 * 1024 * 1024;
+
+// How long V8 may take per idle notification, and how many it gets at the end of an input.
+const int kIdleHintMillis = 20;
+const int kMaxIdleRounds = 10;
+
+void SetImeResourceConstraints(){
+    // Only the first loadjs comes before V8 is initialized, a reload after killjs would fail.
+    static bool constraintsSet = false;
+    if (constraintsSet) return;
+    constraintsSet = true;
+
+    ResourceConstraints constraints;
+    constraints.set_max_young_space_size(kMaxYoungSpaceSize);
+    constraints.set_max_old_space_size(kMaxOldSpaceSize);
+    constraints.set_max_executable_size(kMaxExecutableSize);
+    if (!v8::SetResourceConstraints(&constraints)) {
+        LOGI("Can't set the V8 resource constraints");
+    }
+}
+
+void DisposeAvroFunctions(){
+    avroparsefunc.Dispose();
+    avroparsefunc.Clear();
+    avrosuggestfunc.Dispose();
+    avrosuggestfunc.Clear();
+    avroglobal.Dispose();
+    avroglobal.Clear();
+}
+
+// Empty if the scripts left |name| undefined.
+Persistent<Function> GetAvroFunction(Handle<Object> global, const char* name){
+    Handle<Value> value = global->Get(String::NewSymbol(name));
+    if (!value->IsFunction()) {
+        LOGI("%s is not a function",name);
+        return Persistent<Function>();
+    }
+    return Persistent<Function>::New(Handle<Function>::Cast(value));
+}
+
+void ResolveAvroFunctions(){
+    HandleScope handle_scope;
+    Context::Scope context_scope(context);
+    DisposeAvroFunctions();
+    Handle<Object> global = context->Global();
+    avroglobal = Persistent<Object>::New(global);
+    avroparsefunc = GetAvroFunction(global, "avroparsefunc");
+    avrosuggestfunc = GetAvroFunction(global, "avroparse");
+}
+
 extern "C" {
 	JNIEXPORT void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_setdir( JNIEnv* env,jobject thiz, jstring sk1);
 	JNIEXPORT void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_loadjs( JNIEnv* env,jobject thiz, jstring sk1, jstring sk2);
 	JNIEXPORT void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_killjs( JNIEnv* env,jobject thiz);
 	JNIEXPORT jstring JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_avroparse( JNIEnv* env,jobject thiz,jstring sk1);
+	JNIEXPORT jboolean JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_loaddict( JNIEnv* env,jobject thiz,jstring sourceDir,jlong offset,jlong length);
+	JNIEXPORT jobjectArray JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_avrosearch( JNIEnv* env,jobject thiz,jstring sk1);
+	JNIEXPORT jobjectArray JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_avrosuggest( JNIEnv* env,jobject thiz,jstring sk1);
+	JNIEXPORT jboolean JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_startsuggest( JNIEnv* env,jobject thiz);
+	JNIEXPORT void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_stopsuggest( JNIEnv* env,jobject thiz);
+	JNIEXPORT void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_postsuggest( JNIEnv* env,jobject thiz,jint sequence,jstring sk1);
+	JNIEXPORT jint JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_avroselection( JNIEnv* env,jobject thiz);
+	JNIEXPORT jboolean JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_opensel( JNIEnv* env,jobject thiz,jstring path);
+	JNIEXPORT void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_selectsuggest( JNIEnv* env,jobject thiz,jstring sk1,jstring word);
+	JNIEXPORT jstring JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_avrocachestats( JNIEnv* env,jobject thiz);
+	JNIEXPORT void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_settrace( JNIEnv* env,jobject thiz,jboolean enabled);
+	JNIEXPORT jstring JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_avrotrace( JNIEnv* env,jobject thiz);
+	JNIEXPORT jboolean JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_dumptrace( JNIEnv* env,jobject thiz,jstring path);
+	JNIEXPORT void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_jsidle( JNIEnv* env,jobject thiz,jboolean finished);
+	JNIEXPORT void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_jslowmemory( JNIEnv* env,jobject thiz);
+	JNIEXPORT void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_trimdict( JNIEnv* env,jobject thiz);
 };
 
 void GetJStringContent(JNIEnv *AEnv, jstring AStr, std::string &ARes) {
+  AVRO_TRACE("jni.getstring");
   if (!AStr) {
     ARes.clear();
     return;
@@ -91,6 +251,77 @@ void GetJStringContent(JNIEnv *AEnv, jstring AStr, std::string &ARes) {
   AEnv->ReleaseStringUTFChars(AStr,s);
 }
 
+jobjectArray NewStringArray(JNIEnv *AEnv, const std::vector<std::string> &AStrings) {
+  AVRO_TRACE("jni.newarray");
+  jclass stringClass = AEnv->FindClass("java/lang/String");
+  jobjectArray array = AEnv->NewObjectArray(AStrings.size(), stringClass, NULL);
+  for (size_t i = 0; i < AStrings.size(); i++) {
+    jstring str = AEnv->NewStringUTF(AStrings[i].c_str());
+    AEnv->SetObjectArrayElement(array, i, str);
+    AEnv->DeleteLocalRef(str);
+  }
+  AEnv->DeleteLocalRef(stringClass);
+  return array;
+}
+
+// Hands the worker's suggestions to PhoneticIM.onSuggestions(), on the worker thread.
+class JavaSuggestionListener : public avro::SuggestionListener {
+ public:
+  JavaSuggestionListener(JavaVM *vm, jobject service, jmethodID method)
+      : mVm(vm), mEnv(NULL), mService(service), mMethod(method) {}
+
+  virtual void onWorkerStarted() {
+    mVm->AttachCurrentThread(&mEnv, NULL);
+  }
+
+  virtual void onWorkerStopped() {
+    mVm->DetachCurrentThread();
+    mEnv = NULL;
+  }
+
+  virtual void onSuggestions(const int sequence, const std::vector<std::string> &words,
+      const int selection) {
+    jobjectArray array = NewStringArray(mEnv, words);
+    mEnv->CallVoidMethod(mService, mMethod, sequence, array, selection);
+    mEnv->DeleteLocalRef(array);
+  }
+
+  jobject service() const {
+    return mService;
+  }
+
+ private:
+  JavaVM *mVm;
+  JNIEnv *mEnv;
+  jobject mService;
+  jmethodID mMethod;
+};
+
+// Builds suggestions off the UI thread once started, see startsuggest.
+avro::SuggestionWorker *suggestionWorker = NULL;
+JavaSuggestionListener *suggestionListener = NULL;
+
+// Index of the candidate picked before among the ones the last avrosuggest returned.
+int suggestionSelection = 0;
+
+// Java and V8 both keep strings as UTF-16, so chars are copied straight across in both
+// directions instead of transcoding through modified UTF-8.
+Handle<String> NewV8String(JNIEnv *AEnv, jstring AStr) {
+  AVRO_TRACE("jni.tov8");
+  jsize length = AStr ? AEnv->GetStringLength(AStr) : 0;
+  if ((jsize)jsbuffer.size() < length + 1) jsbuffer.resize(length + 1);
+  if (length > 0) AEnv->GetStringRegion(AStr, 0, length, (jchar*)&jsbuffer[0]);
+  return String::New(&jsbuffer[0], length);
+}
+
+jstring NewJString(JNIEnv *AEnv, Handle<String> AStr) {
+  AVRO_TRACE("jni.fromv8");
+  int length = AStr->Length();
+  if ((int)jsbuffer.size() < length + 1) jsbuffer.resize(length + 1);
+  AStr->Write(&jsbuffer[0], 0, length);
+  return AEnv->NewString((const jchar*)&jsbuffer[0], length);
+}
+
 
 void Java_com_omicronlab_avrokeyboard_PhoneticIM_loadjs(JNIEnv* env,jobject thiz,jstring sk1, jstring sk2){
     std::string filepath1;
@@ -103,21 +334,32 @@ void Java_com_omicronlab_avrokeyboard_PhoneticIM_loadjs(JNIEnv* env,jobject thiz
     
     // Enter the created context for compiling and running script. 
 
+	SetImeResourceConstraints();
+
+	HandleScope handle_scope;
 	Handle<ObjectTemplate> global = ObjectTemplate::New();
 	
 	global->Set(String::New("print"), FunctionTemplate::New(Print));
 	
 	context = Context::New(NULL, global);
 	
-	loadfile(filepath1);
-	loadfile(filepath2);
+	if (IsAvroLoaded()) {
+		LOGI("Avro context restored from snapshot, not loading js files");
+	} else {
+		loadfile(filepath1);
+		loadfile(filepath2);
+	}
 	
+	ResolveAvroFunctions();
 }
 
 void Java_com_omicronlab_avrokeyboard_PhoneticIM_killjs( JNIEnv* env,jobject thiz){
 	
+	DisposeAvroFunctions();
 	Context::Scope context_scope(context);
 	context.Dispose();
+	context.Clear();
+	V8::ContextDisposedNotification();
 	
 }
 
@@ -127,29 +369,239 @@ void Java_com_omicronlab_avrokeyboard_PhoneticIM_setdir( JNIEnv* env,jobject thi
 }
 
 jstring JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_avroparse( JNIEnv* env,jobject thiz,jstring sk1) {
+  AVRO_TRACE("avroparse");
+  if (avroparsefunc.IsEmpty()) return NULL;
 	
-  std::string banglatxt;
-
-  //convert java String to Cpp String  
-  GetJStringContent(env,sk1,banglatxt);
-    
+  HandleScope handle_scope;
+  avro::TraceSpan scope_span("v8.scope");
   Context::Scope context_scope(context);
+  scope_span.finish();
   
-  Handle<Object> global = context->Global();
-  Handle<Value> avro_parse = global->Get(String::New("avroparsefunc"));
-  Handle<Function> avro_parse_func = Handle<Function>::Cast(avro_parse);
   Handle<Value> args[1];
   Handle<Value> result;
 
-  args[0] = v8::String::New(banglatxt.c_str());
+  args[0] = NewV8String(env, sk1);
   
-  result = avro_parse_func->Call(global, 1, args);
+  avro::TraceSpan call_span("v8.call");
+  result = avroparsefunc->Call(avroglobal, 1, args);
+  call_span.finish();
+  if (result.IsEmpty()) return NULL;
   
+  return NewJString(env, result->ToString());
+}
 
-  // Convert the result to an ASCII string 
-  String::Utf8Value ascii(result);
+// Maps the binary dictionary, either straight out of the apk or from a copy in the files dir.
+jboolean JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_loaddict( JNIEnv* env,jobject thiz,jstring sourceDir,jlong offset,jlong length) {
+  std::string filepath;
 
-  std::string bntext = std::string(*ascii);
-  
-  return env->NewStringUTF(bntext.c_str());
+  GetJStringContent(env,sourceDir,filepath);
+  LOGI("Loading dictionary from : %s, offset %ld, length %ld",filepath.c_str(),(long)offset,(long)length);
+
+  bool loaded = dictionary.open(filepath.c_str(), offset, length);
+  suggestionBuilder.reset();
+  return loaded ? JNI_TRUE : JNI_FALSE;
+}
+
+// Unmaps the dictionary tables, each is mapped again the next time a word starting with one
+// of its letters is typed.
+void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_trimdict( JNIEnv* env,jobject thiz) {
+  if (!dictionary.isLoaded()) return;
+
+  int dropped = suggestionWorker ? suggestionWorker->trimMemory() : suggestionBuilder.trimMemory();
+  LOGI("Dropped %d dictionary tables", dropped);
+}
+
+// Native equivalent of dbsearch.search(), words come back in the same order.
+jobjectArray JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_avrosearch( JNIEnv* env,jobject thiz,jstring sk1) {
+  AVRO_TRACE("avrosearch");
+  std::string entext;
+  std::vector<std::string> words;
+
+  GetJStringContent(env,sk1,entext);
+  if (dictionary.isLoaded()) {
+    dictionary.search(entext, &words);
+  }
+
+  return NewStringArray(env, words);
+}
+
+// The candidate list for the typed text, handed over as a String[] rather than as JSON.
+// Built natively when the dictionary is loaded, by the js SuggestionBuilder otherwise.
+jobjectArray JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_avrosuggest( JNIEnv* env,jobject thiz,jstring sk1) {
+  AVRO_TRACE("avrosuggest");
+  if (dictionary.isLoaded()) {
+    std::string entext;
+    std::vector<std::string> words;
+
+    GetJStringContent(env,sk1,entext);
+    if (suggestionWorker) {
+      suggestionWorker->suggest(entext, &words, &suggestionSelection);
+    } else {
+      suggestionBuilder.suggest(entext, &words, &suggestionSelection);
+    }
+    return NewStringArray(env, words);
+  }
+  suggestionSelection = 0;
+  if (avrosuggestfunc.IsEmpty()) return NewStringArray(env, std::vector<std::string>());
+
+  HandleScope handle_scope;
+  avro::TraceSpan scope_span("v8.scope");
+  Context::Scope context_scope(context);
+  scope_span.finish();
+
+  // avroparse returns the words array.
+  Handle<Value> args[1];
+  args[0] = NewV8String(env, sk1);
+  avro::TraceSpan call_span("v8.call");
+  Handle<Value> result = avrosuggestfunc->Call(avroglobal, 1, args);
+  call_span.finish();
+  if (result.IsEmpty() || !result->IsArray()) return NewStringArray(env, std::vector<std::string>());
+  Handle<Array> words = Handle<Array>::Cast(result);
+
+  jclass stringClass = env->FindClass("java/lang/String");
+  uint32_t length = words->Length();
+  jobjectArray array = env->NewObjectArray(length, stringClass, NULL);
+  for (uint32_t i = 0; i < length; i++) {
+    // Each word's handles go with it, however many words there are.
+    HandleScope word_scope;
+    jstring str = NewJString(env, words->Get(i)->ToString());
+    env->SetObjectArrayElement(array, i, str);
+    env->DeleteLocalRef(str);
+  }
+  env->DeleteLocalRef(stringClass);
+  return array;
+}
+
+// Starts building suggestions on a thread of its own, they come back through
+// PhoneticIM.onSuggestions(int, String[], int). Needs the dictionary, V8 stays on the UI thread.
+jboolean JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_startsuggest( JNIEnv* env,jobject thiz) {
+  if (suggestionWorker) return JNI_TRUE;
+  if (!dictionary.isLoaded()) return JNI_FALSE;
+
+  JavaVM *vm;
+  env->GetJavaVM(&vm);
+  jclass serviceClass = env->GetObjectClass(thiz);
+  jmethodID method = env->GetMethodID(serviceClass, "onSuggestions", "(I[Ljava/lang/String;I)V");
+  env->DeleteLocalRef(serviceClass);
+  if (method == NULL) return JNI_FALSE;
+
+  suggestionListener = new JavaSuggestionListener(vm, env->NewGlobalRef(thiz), method);
+  suggestionWorker = new avro::SuggestionWorker(&suggestionBuilder, suggestionListener);
+  if (!suggestionWorker->start()) {
+    Java_com_omicronlab_avrokeyboard_PhoneticIM_stopsuggest(env, thiz);
+    return JNI_FALSE;
+  }
+  LOGI("Suggestion worker started");
+  return JNI_TRUE;
+}
+
+void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_stopsuggest( JNIEnv* env,jobject thiz) {
+  if (!suggestionWorker) return;
+
+  delete suggestionWorker;
+  suggestionWorker = NULL;
+  env->DeleteGlobalRef(suggestionListener->service());
+  delete suggestionListener;
+  suggestionListener = NULL;
+}
+
+void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_postsuggest( JNIEnv* env,jobject thiz,jint sequence,jstring sk1) {
+  AVRO_TRACE("postsuggest");
+  std::string entext;
+
+  GetJStringContent(env,sk1,entext);
+  if (suggestionWorker) suggestionWorker->post(sequence, entext);
+}
+
+jint JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_avroselection( JNIEnv* env,jobject thiz) {
+  return suggestionSelection;
+}
+
+// The candidates the user picks are learned natively, one small append to the log per pick.
+jboolean JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_opensel( JNIEnv* env,jobject thiz,jstring path) {
+  std::string filepath;
+
+  GetJStringContent(env,path,filepath);
+  return suggestionBuilder.openSelections(filepath.c_str()) ? JNI_TRUE : JNI_FALSE;
+}
+
+void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_selectsuggest( JNIEnv* env,jobject thiz,jstring sk1,jstring word) {
+  AVRO_TRACE("selectsuggest");
+  std::string entext;
+  std::string bntext;
+
+  GetJStringContent(env,sk1,entext);
+  GetJStringContent(env,word,bntext);
+  if (suggestionWorker) {
+    suggestionWorker->selectCandidate(entext, bntext);
+  } else {
+    suggestionBuilder.updateCandidateSelection(entext, bntext);
+    suggestionBuilder.stringCommitted(bntext);
+  }
+}
+
+// Hit rates and sizes of the suggestion caches, for tuning their capacity.
+jstring JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_avrocachestats( JNIEnv* env,jobject thiz) {
+  avro::CacheStats phonetic;
+  avro::CacheStats classic;
+  if (suggestionWorker) {
+    suggestionWorker->getCacheStats(&phonetic, &classic);
+  } else {
+    suggestionBuilder.getCacheStats(&phonetic, &classic);
+  }
+
+  char stats[512];
+  const avro::CacheStats *caches[] = { &phonetic, &classic };
+  const char *names[] = { "phonetic", "classic" };
+  int length = 0;
+  for (int i = 0; i < 2; i++) {
+    length += snprintf(stats + length, sizeof(stats) - length,
+        "%s%s: %d hits, %d misses, %d evictions, %d entries, %u/%u bytes", i ? "; " : "", names[i],
+        caches[i]->hits, caches[i]->misses, caches[i]->evictions, caches[i]->entries,
+        (unsigned int)caches[i]->bytes, (unsigned int)caches[i]->capacity);
+  }
+  return env->NewStringUTF(stats);
+}
+
+// Spans of the bridge and the engine are recorded from here on, see avro/trace.h.
+void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_settrace( JNIEnv* env,jobject thiz,jboolean enabled) {
+  avro::Trace::setEnabled(enabled == JNI_TRUE);
+  LOGI("Tracing %s", enabled == JNI_TRUE ? "enabled" : "disabled");
+}
+
+// The recorded spans as Chrome trace JSON, for chrome://tracing or Perfetto.
+jstring JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_avrotrace( JNIEnv* env,jobject thiz) {
+  std::string json;
+  avro::Trace::dump(&json);
+  return env->NewStringUTF(json.c_str());
+}
+
+jboolean JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_dumptrace( JNIEnv* env,jobject thiz,jstring path) {
+  std::string filepath;
+
+  GetJStringContent(env,path,filepath);
+  if (!avro::Trace::dumpToFile(filepath.c_str())) return JNI_FALSE;
+  LOGI("Trace written to : %s",filepath.c_str());
+  return JNI_TRUE;
+}
+
+// Lets V8 collect garbage while nobody is typing, between words and once the input is finished,
+// rather than in the middle of a keystroke.
+void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_jsidle( JNIEnv* env,jobject thiz,jboolean finished) {
+  if (context.IsEmpty()) return;
+
+  AVRO_TRACE("v8.idle");
+  int rounds = finished == JNI_TRUE ? kMaxIdleRounds : 1;
+  // True once there is nothing left worth collecting.
+  for (int i = 0; i < rounds; i++) {
+    if (V8::IdleNotification(kIdleHintMillis)) break;
+  }
+}
+
+void JNICALL Java_com_omicronlab_avrokeyboard_PhoneticIM_jslowmemory( JNIEnv* env,jobject thiz) {
+  if (context.IsEmpty()) return;
+
+  AVRO_TRACE("v8.lowmemory");
+  V8::LowMemoryNotification();
+  LOGI("V8 low memory notification");
 }
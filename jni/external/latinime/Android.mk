@@ -53,6 +53,7 @@ LATIN_IME_CORE_SRC_FILES := \
     dictionary.cpp \
     dic_traverse_wrapper.cpp \
     digraph_utils.cpp \
+    flat_node_index.cpp \
     proximity_info.cpp \
     proximity_info_params.cpp \
     proximity_info_state.cpp \
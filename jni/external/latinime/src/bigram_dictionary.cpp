@@ -19,8 +19,8 @@
 #define LOG_TAG "LatinIME: bigram_dictionary.cpp"
 
 #include "bigram_dictionary.h"
+#include "bigram_hash_map.h"
 #include "binary_format.h"
-#include "bloom_filter.h"
 #include "char_utils.h"
 #include "defines.h"
 #include "dictionary.h"
@@ -166,9 +166,9 @@ int BigramDictionary::getBigramListPositionForWord(const int *prevWord, const in
     return pos;
 }
 
-void BigramDictionary::fillBigramAddressToProbabilityMapAndFilter(const int *prevWord,
-        const int prevWordLength, std::map<int, int> *map, uint8_t *filter) const {
-    memset(filter, 0, BIGRAM_FILTER_BYTE_SIZE);
+void BigramDictionary::fillBigramAddressToProbabilityMap(const int *prevWord,
+        const int prevWordLength, BigramHashMap *map) const {
+    map->clear();
     const uint8_t *const root = DICT_ROOT;
     int pos = getBigramListPositionForWord(prevWord, prevWordLength,
             false /* forceLowerCaseSearch */);
@@ -185,8 +185,7 @@ void BigramDictionary::fillBigramAddressToProbabilityMapAndFilter(const int *pre
         const int probability = BinaryFormat::MASK_ATTRIBUTE_PROBABILITY & bigramFlags;
         const int bigramPos = BinaryFormat::getAttributeAddressAndForwardPointer(root, bigramFlags,
                 &pos);
-        (*map)[bigramPos] = probability;
-        setInFilter(filter, bigramPos);
+        map->put(bigramPos, probability);
     } while (BinaryFormat::FLAG_ATTRIBUTE_HAS_NEXT & bigramFlags);
 }
 
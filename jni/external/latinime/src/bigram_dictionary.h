@@ -17,20 +17,21 @@
 #ifndef LATINIME_BIGRAM_DICTIONARY_H
 #define LATINIME_BIGRAM_DICTIONARY_H
 
-#include <map>
 #include <stdint.h>
 
 #include "defines.h"
 
 namespace latinime {
 
+class BigramHashMap;
+
 class BigramDictionary {
  public:
     BigramDictionary(const uint8_t *const streamStart);
     int getBigrams(const int *word, int length, int *inputCodePoints, int inputSize, int *outWords,
             int *frequencies, int *outputTypes) const;
-    void fillBigramAddressToProbabilityMapAndFilter(const int *prevWord, const int prevWordLength,
-            std::map<int, int> *map, uint8_t *filter) const;
+    void fillBigramAddressToProbabilityMap(const int *prevWord, const int prevWordLength,
+            BigramHashMap *map) const;
     bool isValidBigram(const int *word1, int length1, const int *word2, int length2) const;
     ~BigramDictionary();
  private:
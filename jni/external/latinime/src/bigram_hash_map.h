@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2026 The Avro Keyboard Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LATINIME_BIGRAM_HASH_MAP_H
+#define LATINIME_BIGRAM_HASH_MAP_H
+
+#include <cstring>
+#include <stdint.h>
+#include <vector>
+
+#include "defines.h"
+
+namespace latinime {
+
+/**
+ * Maps dictionary positions to ints, which is all the bigram lookups need: the position of a next
+ * word to its encoded bigram probability, or the position of a previous word to a cache index.
+ *
+ * Open addressing over a power of two number of slots, split into groups of eight. Each slot has
+ * a control byte holding 7 bits of the hash of its key, or EMPTY. A lookup loads the eight control
+ * bytes of a group as one 64 bit word and finds the slots whose bits match, and whether the group
+ * has an empty slot at all, with a few word operations instead of a byte at a time; a miss
+ * usually costs a single group. There is no removal, only clear(), which keeps the memory.
+ */
+class BigramHashMap {
+ public:
+    BigramHashMap() : mControls(), mKeys(), mValues(), mGroupMask(0), mSize(0) {
+        allocate(MIN_GROUP_COUNT);
+    }
+
+    // Reserves enough room for |size| entries.
+    explicit BigramHashMap(const int size)
+            : mControls(), mKeys(), mValues(), mGroupMask(0), mSize(0) {
+        int groupCount = MIN_GROUP_COUNT;
+        while (groupCount * GROUP_SIZE * MAX_LOAD_NUMERATOR < size * MAX_LOAD_DENOMINATOR) {
+            groupCount *= 2;
+        }
+        allocate(groupCount);
+    }
+
+    // Non virtual inline destructor -- never inherit this class
+    ~BigramHashMap() {}
+
+    int size() const {
+        return mSize;
+    }
+
+    void clear() {
+        if (mSize == 0) {
+            return;
+        }
+        memset(&mControls[0], EMPTY, mControls.size());
+        mSize = 0;
+    }
+
+    // Returns whether |key| is in the map, and its value in |value| if so.
+    AK_FORCE_INLINE bool find(const int key, int *const value) const {
+        const uint32_t hash = getHash(key);
+        const uint64_t tagPattern = BYTES_LOW_BITS * getTag(hash);
+        uint32_t group = getFirstGroup(hash);
+        for (uint32_t probe = 1; ; ++probe) {
+            const uint64_t controls = loadGroup(group);
+            for (uint64_t matches = matchTag(controls, tagPattern); matches;
+                    matches &= matches - 1) {
+                const int slot = static_cast<int>(group) * GROUP_SIZE + lowestByte(matches);
+                if (mKeys[slot] == key) {
+                    *value = mValues[slot];
+                    return true;
+                }
+            }
+            if (controls & BYTES_HIGH_BITS) {
+                // An empty slot ends the probe, as no insertion went past it.
+                return false;
+            }
+            group = (group + probe) & mGroupMask;
+        }
+    }
+
+    // Adds |key|, or sets its value if it is already there.
+    AK_FORCE_INLINE void put(const int key, const int value) {
+        if ((mSize + 1) * MAX_LOAD_DENOMINATOR > getCapacity() * MAX_LOAD_NUMERATOR) {
+            rehash((mGroupMask + 1) * 2);
+        }
+        const uint32_t hash = getHash(key);
+        const uint8_t tag = getTag(hash);
+        const uint64_t tagPattern = BYTES_LOW_BITS * tag;
+        uint32_t group = getFirstGroup(hash);
+        for (uint32_t probe = 1; ; ++probe) {
+            const uint64_t controls = loadGroup(group);
+            for (uint64_t matches = matchTag(controls, tagPattern); matches;
+                    matches &= matches - 1) {
+                const int slot = static_cast<int>(group) * GROUP_SIZE + lowestByte(matches);
+                if (mKeys[slot] == key) {
+                    mValues[slot] = value;
+                    return;
+                }
+            }
+            const uint64_t empties = controls & BYTES_HIGH_BITS;
+            if (empties) {
+                const int slot = static_cast<int>(group) * GROUP_SIZE + lowestByte(empties);
+                mControls[slot] = tag;
+                mKeys[slot] = key;
+                mValues[slot] = value;
+                ++mSize;
+                return;
+            }
+            group = (group + probe) & mGroupMask;
+        }
+    }
+
+ private:
+    DISALLOW_COPY_AND_ASSIGN(BigramHashMap);
+
+    static const int GROUP_SIZE = 8;
+    static const uint32_t MIN_GROUP_COUNT = 2;
+    // Grows past 7/8 full, which keeps an empty slot in every few groups for misses to stop at.
+    static const int MAX_LOAD_NUMERATOR = 7;
+    static const int MAX_LOAD_DENOMINATOR = 8;
+    // Full slots have the high bit clear, so that one AND tells the empty slots of a group.
+    static const uint8_t EMPTY = 0x80;
+    static const uint64_t BYTES_LOW_BITS = 0x0101010101010101ULL;
+    static const uint64_t BYTES_HIGH_BITS = 0x8080808080808080ULL;
+
+    static AK_FORCE_INLINE uint32_t getHash(const int key) {
+        uint32_t hash = static_cast<uint32_t>(key) * 0x9E3779B1U;
+        return hash ^ (hash >> 15);
+    }
+
+    static AK_FORCE_INLINE uint8_t getTag(const uint32_t hash) {
+        return static_cast<uint8_t>(hash & 0x7F);
+    }
+
+    // Bytes of |controls| equal to the tag repeated in |tagPattern| get their high bit set. The
+    // borrow can flag a byte next to a real match by mistake, which the key comparison catches.
+    static AK_FORCE_INLINE uint64_t matchTag(const uint64_t controls, const uint64_t tagPattern) {
+        const uint64_t diff = controls ^ tagPattern;
+        return (diff - BYTES_LOW_BITS) & ~diff & BYTES_HIGH_BITS;
+    }
+
+    // The index of the lowest byte of |mask| that has its high bit set.
+    static AK_FORCE_INLINE int lowestByte(const uint64_t mask) {
+        return __builtin_ctzll(mask) >> 3;
+    }
+
+    AK_FORCE_INLINE uint32_t getFirstGroup(const uint32_t hash) const {
+        return (hash >> 7) & mGroupMask;
+    }
+
+    // Byte i of the word is the control byte of slot i of the group.
+    AK_FORCE_INLINE uint64_t loadGroup(const uint32_t group) const {
+        uint64_t word;
+        memcpy(&word, &mControls[group * GROUP_SIZE], sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        word = __builtin_bswap64(word);
+#endif
+        return word;
+    }
+
+    int getCapacity() const {
+        return static_cast<int>(mGroupMask + 1) * GROUP_SIZE;
+    }
+
+    void allocate(const uint32_t groupCount) {
+        mControls.assign(groupCount * GROUP_SIZE, static_cast<uint8_t>(EMPTY));
+        mKeys.resize(groupCount * GROUP_SIZE);
+        mValues.resize(groupCount * GROUP_SIZE);
+        mGroupMask = groupCount - 1;
+        mSize = 0;
+    }
+
+    void rehash(const uint32_t groupCount) {
+        std::vector<uint8_t> controls;
+        std::vector<int> keys;
+        std::vector<int> values;
+        controls.swap(mControls);
+        keys.swap(mKeys);
+        values.swap(mValues);
+        allocate(groupCount);
+        for (size_t i = 0; i < controls.size(); ++i) {
+            if (controls[i] != EMPTY) {
+                put(keys[i], values[i]);
+            }
+        }
+    }
+
+    std::vector<uint8_t> mControls;
+    std::vector<int> mKeys;
+    std::vector<int> mValues;
+    uint32_t mGroupMask;
+    int mSize;
+};
+} // namespace latinime
+#endif // LATINIME_BIGRAM_HASH_MAP_H
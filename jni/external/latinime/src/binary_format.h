@@ -18,12 +18,10 @@
 #define LATINIME_BINARY_FORMAT_H
 
 #include <cstdlib>
-#include <map>
 #include <stdint.h>
 
-#include "bloom_filter.h"
+#include "bigram_hash_map.h"
 #include "char_utils.h"
-#include "hash_map_compat.h"
 
 namespace latinime {
 
@@ -93,13 +91,12 @@ class BinaryFormat {
             int *outWord, int *outUnigramProbability);
     static int computeProbabilityForBigram(
             const int unigramProbability, const int bigramProbability);
-    static int getProbability(const int position, const std::map<int, int> *bigramMap,
-            const uint8_t *bigramFilter, const int unigramProbability);
-    static int getBigramProbabilityFromHashMap(const int position,
-            const hash_map_compat<int, int> *bigramMap, const int unigramProbability);
+    static int getProbability(const int position, const BigramHashMap *bigramMap,
+            const int unigramProbability);
     static float getMultiWordCostMultiplier(const uint8_t *const dict, const int dictSize);
+    static bool usesFlatNodeIndex(const uint8_t *const dict, const int dictSize);
     static void fillBigramProbabilityToHashMap(const uint8_t *const root, int position,
-            hash_map_compat<int, int> *bigramMap);
+            BigramHashMap *bigramMap);
     static int getBigramProbability(const uint8_t *const root, int position,
             const int nextPosition, const int unigramProbability);
 
@@ -282,6 +279,14 @@ inline float BinaryFormat::getMultiWordCostMultiplier(const uint8_t *const dict,
     return 100.0f / static_cast<float>(headerValue);
 }
 
+// Whether the trie is traversed through a FlatNodeIndex, which trades memory for speed. It is on
+// unless the dictionary opts out with USES_FLAT_NODE_INDEX=0, and the index is only built for
+// tries that fit in MAX_FLAT_NODE_INDEX_BYTE_SIZE.
+inline bool BinaryFormat::usesFlatNodeIndex(const uint8_t *const dict, const int dictSize) {
+    const int headerValue = readHeaderValueInt(dict, dictSize, "USES_FLAT_NODE_INDEX");
+    return headerValue == S_INT_MIN || headerValue > 0;
+}
+
 inline uint8_t BinaryFormat::getFlagsAndForwardPointer(const uint8_t *const dict, int *pos) {
     return dict[(*pos)++];
 }
@@ -700,32 +705,18 @@ inline int BinaryFormat::computeProbabilityForBigram(
 }
 
 // This returns a probability in log space.
-inline int BinaryFormat::getProbability(const int position, const std::map<int, int> *bigramMap,
-        const uint8_t *bigramFilter, const int unigramProbability) {
-    if (!bigramMap || !bigramFilter) return backoff(unigramProbability);
-    if (!isInFilter(bigramFilter, position)) return backoff(unigramProbability);
-    const std::map<int, int>::const_iterator bigramProbabilityIt = bigramMap->find(position);
-    if (bigramProbabilityIt != bigramMap->end()) {
-        const int bigramProbability = bigramProbabilityIt->second;
-        return computeProbabilityForBigram(unigramProbability, bigramProbability);
-    }
-    return backoff(unigramProbability);
-}
-
-// This returns a probability in log space.
-inline int BinaryFormat::getBigramProbabilityFromHashMap(const int position,
-        const hash_map_compat<int, int> *bigramMap, const int unigramProbability) {
+inline int BinaryFormat::getProbability(const int position, const BigramHashMap *bigramMap,
+        const int unigramProbability) {
     if (!bigramMap) return backoff(unigramProbability);
-    const hash_map_compat<int, int>::const_iterator bigramProbabilityIt = bigramMap->find(position);
-    if (bigramProbabilityIt != bigramMap->end()) {
-        const int bigramProbability = bigramProbabilityIt->second;
+    int bigramProbability;
+    if (bigramMap->find(position, &bigramProbability)) {
         return computeProbabilityForBigram(unigramProbability, bigramProbability);
     }
     return backoff(unigramProbability);
 }
 
 AK_FORCE_INLINE void BinaryFormat::fillBigramProbabilityToHashMap(
-        const uint8_t *const root, int position, hash_map_compat<int, int> *bigramMap) {
+        const uint8_t *const root, int position, BigramHashMap *bigramMap) {
     position = getBigramListPositionForWordPosition(root, position);
     if (0 == position) return;
 
@@ -735,7 +726,7 @@ AK_FORCE_INLINE void BinaryFormat::fillBigramProbabilityToHashMap(
         const int probability = MASK_ATTRIBUTE_PROBABILITY & bigramFlags;
         const int bigramPos = getAttributeAddressAndForwardPointer(root, bigramFlags,
                 &position);
-        (*bigramMap)[bigramPos] = probability;
+        bigramMap->put(bigramPos, probability);
     } while (FLAG_ATTRIBUTE_HAS_NEXT & bigramFlags);
 }
 
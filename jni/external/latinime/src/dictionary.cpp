@@ -18,13 +18,15 @@
 
 #include "dictionary.h"
 
-#include <map> // TODO: remove
 #include <stdint.h>
 
 #include "bigram_dictionary.h"
+#include "bigram_hash_map.h"
 #include "binary_format.h"
 #include "defines.h"
 #include "dic_traverse_wrapper.h"
+#include "flat_node_index.h"
+#include "suggest/core/session/dic_traverse_session.h"
 #include "suggest/core/suggest.h"
 #include "suggest/policyimpl/gesture/gesture_suggest_policy_factory.h"
 #include "suggest/policyimpl/typing/typing_suggest_policy_factory.h"
@@ -41,7 +43,9 @@ Dictionary::Dictionary(void *dict, int dictSize, int mmapFd, int dictBufAdjust)
                   BinaryFormat::getFlags(mDict, dictSize))),
           mBigramDictionary(new BigramDictionary(mOffsetDict)),
           mGestureSuggest(new Suggest(GestureSuggestPolicyFactory::getGestureSuggestPolicy())),
-          mTypingSuggest(new Suggest(TypingSuggestPolicyFactory::getTypingSuggestPolicy())) {
+          mTypingSuggest(new Suggest(TypingSuggestPolicyFactory::getTypingSuggestPolicy())),
+          mFlatNodeIndex(BinaryFormat::usesFlatNodeIndex(mDict, dictSize)
+                  ? FlatNodeIndex::create(mOffsetDict, MAX_FLAT_NODE_INDEX_BYTE_SIZE) : 0) {
 }
 
 Dictionary::~Dictionary() {
@@ -49,6 +53,7 @@ Dictionary::~Dictionary() {
     delete mBigramDictionary;
     delete mGestureSuggest;
     delete mTypingSuggest;
+    delete mFlatNodeIndex;
 }
 
 int Dictionary::getSuggestions(ProximityInfo *proximityInfo, void *traverseSession,
@@ -79,13 +84,25 @@ int Dictionary::getSuggestions(ProximityInfo *proximityInfo, void *traverseSessi
             }
             return result;
         } else {
-            std::map<int, int> bigramMap;
-            uint8_t bigramFilter[BIGRAM_FILTER_BYTE_SIZE];
-            mBigramDictionary->fillBigramAddressToProbabilityMapAndFilter(prevWordCodePoints,
-                    prevWordLength, &bigramMap, bigramFilter);
+            // The session keeps the bigrams of the previous word for as long as it stays the
+            // same, the dictionary itself is shared by sessions that may run concurrently.
+            DicTraverseWrapper::initDicTraverseSession(
+                    traverseSession, this, prevWordCodePoints, prevWordLength);
+            DicTraverseSession *const tSession =
+                    static_cast<DicTraverseSession *>(traverseSession);
+            BigramHashMap localBigramMap;
+            BigramHashMap *const bigramMap =
+                    tSession ? tSession->getPrevWordBigramMap() : &localBigramMap;
+            if (!tSession || !tSession->hasPrevWordBigrams()) {
+                mBigramDictionary->fillBigramAddressToProbabilityMap(prevWordCodePoints,
+                        prevWordLength, bigramMap);
+                if (tSession) {
+                    tSession->setHasPrevWordBigrams();
+                }
+            }
             result = mUnigramDictionary->getSuggestions(proximityInfo, xcoordinates, ycoordinates,
-                    inputCodePoints, inputSize, &bigramMap, bigramFilter, useFullEditDistance,
-                    outWords, frequencies, outputTypes);
+                    inputCodePoints, inputSize, bigramMap, useFullEditDistance, outWords,
+                    frequencies, outputTypes);
             return result;
         }
     }
@@ -24,6 +24,7 @@
 namespace latinime {
 
 class BigramDictionary;
+class FlatNodeIndex;
 class ProximityInfo;
 class SuggestInterface;
 class UnigramDictionary;
@@ -69,6 +70,8 @@ class Dictionary {
     int getMmapFd() const { return mMmapFd; }
     int getDictBufAdjust() const { return mDictBufAdjust; }
     int getDictFlags() const;
+    // Null unless the dictionary asked for one and it was small enough
+    const FlatNodeIndex *getFlatNodeIndex() const { return mFlatNodeIndex; }
     virtual ~Dictionary();
 
  private:
@@ -86,6 +89,7 @@ class Dictionary {
     const BigramDictionary *mBigramDictionary;
     SuggestInterface *mGestureSuggest;
     SuggestInterface *mTypingSuggest;
+    const FlatNodeIndex *const mFlatNodeIndex;
 };
 } // namespace latinime
 #endif // LATINIME_DICTIONARY_H
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 The Avro Keyboard Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define LOG_TAG "LatinIME: flat_node_index.cpp"
+
+#include "flat_node_index.h"
+
+#include "binary_format.h"
+#include "defines.h"
+
+namespace latinime {
+
+const int FlatNodeIndex::NODE_BYTE_SIZE = 8 * sizeof(int) + sizeof(uint8_t);
+
+// Gives back what a vector reserved past its size.
+template<typename T>
+static void trimToSize(std::vector<T> *const v) {
+    std::vector<T>(*v).swap(*v);
+}
+
+/* static */ FlatNodeIndex *FlatNodeIndex::create(const uint8_t *const root,
+        const int maxByteSize) {
+    FlatNodeIndex *const index = new FlatNodeIndex();
+    int pos = 0;
+    const int rootGroupCount = BinaryFormat::getGroupCountAndForwardPointer(root, &pos);
+    index->addGroups(root, pos, rootGroupCount);
+    // The entries themselves are the queue of the groups whose children are still to be added,
+    // which lays the trie out breadth first.
+    for (int i = 0; i < index->getNodeCount(); ++i) {
+        const int childrenCount = index->mChildrenCounts[i];
+        if (childrenCount <= 0) {
+            continue;
+        }
+        index->mFirstChildIndices[i] = index->getNodeCount();
+        index->addGroups(root, index->mChildrenPositions[i], childrenCount);
+        if (index->getByteSize() > maxByteSize) {
+            AKLOGI("Flat node index is larger than %d bytes, not using it", maxByteSize);
+            delete index;
+            return 0;
+        }
+    }
+    index->mCodePointStarts.push_back(static_cast<int>(index->mCodePoints.size()));
+    trimToSize(&index->mPositions);
+    trimToSize(&index->mFlags);
+    trimToSize(&index->mCodePointStarts);
+    trimToSize(&index->mCodePoints);
+    trimToSize(&index->mProbabilities);
+    trimToSize(&index->mChildrenPositions);
+    trimToSize(&index->mChildrenCounts);
+    trimToSize(&index->mFirstChildIndices);
+    trimToSize(&index->mAttributesPositions);
+    trimToSize(&index->mSiblingPositions);
+    if (DEBUG_DICT) {
+        AKLOGI("Flat node index: %d nodes, %d bytes", index->getNodeCount(),
+                index->getByteSize());
+    }
+    return index;
+}
+
+int FlatNodeIndex::getByteSize() const {
+    return getNodeCount() * NODE_BYTE_SIZE
+            + static_cast<int>(mCodePoints.size() * sizeof(mCodePoints[0]));
+}
+
+void FlatNodeIndex::addGroups(const uint8_t *const root, int pos, const int count) {
+    for (int i = 0; i < count; ++i) {
+        pos = addNode(root, pos);
+    }
+}
+
+// Decodes the group at |pos| the way DicNodeUtils::createAndGetLeavingChildNode does, and returns
+// the position of its next sibling.
+int FlatNodeIndex::addNode(const uint8_t *const root, int pos) {
+    mPositions.push_back(pos);
+    const uint8_t flags = BinaryFormat::getFlagsAndForwardPointer(root, &pos);
+    const bool hasMultipleChars = (0 != (BinaryFormat::FLAG_HAS_MULTIPLE_CHARS & flags));
+    const bool isTerminal = (0 != (BinaryFormat::FLAG_IS_TERMINAL & flags));
+    const bool hasChildren = BinaryFormat::hasChildrenInFlags(flags);
+    mFlags.push_back(flags);
+
+    mCodePointStarts.push_back(static_cast<int>(mCodePoints.size()));
+    mCodePoints.push_back(BinaryFormat::getCodePointAndForwardPointer(root, &pos));
+    if (hasMultipleChars) {
+        for (int codePoint = BinaryFormat::getCodePointAndForwardPointer(root, &pos);
+                NOT_A_CODE_POINT != codePoint;
+                codePoint = BinaryFormat::getCodePointAndForwardPointer(root, &pos)) {
+            mCodePoints.push_back(codePoint);
+        }
+    }
+
+    mProbabilities.push_back(isTerminal
+            ? BinaryFormat::readProbabilityWithoutMovingPointer(root, pos) : NOT_A_PROBABILITY);
+    pos = BinaryFormat::skipProbability(flags, pos);
+    int childrenPos = hasChildren ? BinaryFormat::readChildrenPosition(root, flags, pos) : 0;
+    const int childrenCount = hasChildren
+            ? BinaryFormat::getGroupCountAndForwardPointer(root, &childrenPos) : 0;
+    mChildrenPositions.push_back(childrenPos);
+    mChildrenCounts.push_back(childrenCount);
+    // Set once the children are added
+    mFirstChildIndices.push_back(NOT_AN_INDEX);
+    mAttributesPositions.push_back(BinaryFormat::skipChildrenPosition(flags, pos));
+    const int siblingPos = BinaryFormat::skipChildrenPosAndAttributes(root, flags, pos);
+    mSiblingPositions.push_back(siblingPos);
+    return siblingPos;
+}
+} // namespace latinime
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 The Avro Keyboard Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LATINIME_FLAT_NODE_INDEX_H
+#define LATINIME_FLAT_NODE_INDEX_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "defines.h"
+
+namespace latinime {
+
+/**
+ * The char groups of a binary dictionary trie decoded once into fixed width arrays, one entry per
+ * group, so that expanding a dic node reads its children with plain loads instead of walking the
+ * variable width encoding. The children of a group take consecutive entries, so a dic node's
+ * children are the range of getChildrenCount() entries from getFirstChildIndex(), and those of
+ * the root start at ROOT_CHILDREN_INDEX.
+ *
+ * The positions kept are those of the binary dictionary, which stays the reference for
+ * everything else (bigrams, shortcuts, terminal lookups).
+ */
+class FlatNodeIndex {
+ public:
+    static const int ROOT_CHILDREN_INDEX = 0;
+
+    // Returns 0 if the index of the trie at |root| would take more than |maxByteSize| bytes.
+    static FlatNodeIndex *create(const uint8_t *const root, const int maxByteSize);
+
+    // Non virtual inline destructor -- never inherit this class
+    ~FlatNodeIndex() {}
+
+    AK_FORCE_INLINE int getPosition(const int index) const {
+        return mPositions[index];
+    }
+
+    AK_FORCE_INLINE uint8_t getFlags(const int index) const {
+        return mFlags[index];
+    }
+
+    AK_FORCE_INLINE int getCodePoint(const int index) const {
+        return mCodePoints[mCodePointStarts[index]];
+    }
+
+    // All the code points of the group, the first one included.
+    AK_FORCE_INLINE const int *getCodePoints(const int index) const {
+        return &mCodePoints[mCodePointStarts[index]];
+    }
+
+    AK_FORCE_INLINE int getCodePointCount(const int index) const {
+        return mCodePointStarts[index + 1] - mCodePointStarts[index];
+    }
+
+    // NOT_A_PROBABILITY for groups that are not terminal
+    AK_FORCE_INLINE int getProbability(const int index) const {
+        return mProbabilities[index];
+    }
+
+    // The position right after the group count of the children, or 0 without children
+    AK_FORCE_INLINE int getChildrenPosition(const int index) const {
+        return mChildrenPositions[index];
+    }
+
+    AK_FORCE_INLINE int getChildrenCount(const int index) const {
+        return mChildrenCounts[index];
+    }
+
+    // NOT_AN_INDEX for groups without children
+    AK_FORCE_INLINE int getFirstChildIndex(const int index) const {
+        return mFirstChildIndices[index];
+    }
+
+    AK_FORCE_INLINE int getAttributesPosition(const int index) const {
+        return mAttributesPositions[index];
+    }
+
+    AK_FORCE_INLINE int getSiblingPosition(const int index) const {
+        return mSiblingPositions[index];
+    }
+
+    int getNodeCount() const {
+        return static_cast<int>(mPositions.size());
+    }
+
+    int getByteSize() const;
+
+ private:
+    DISALLOW_COPY_AND_ASSIGN(FlatNodeIndex);
+    // What an entry takes in the arrays, besides its code points
+    static const int NODE_BYTE_SIZE;
+
+    FlatNodeIndex()
+            : mPositions(), mFlags(), mCodePointStarts(), mCodePoints(), mProbabilities(),
+              mChildrenPositions(), mChildrenCounts(), mFirstChildIndices(),
+              mAttributesPositions(), mSiblingPositions() {}
+
+    void addGroups(const uint8_t *const root, int pos, const int count);
+    int addNode(const uint8_t *const root, int pos);
+
+    std::vector<int> mPositions;
+    std::vector<uint8_t> mFlags;
+    // Has one more entry than there are groups, so that the last group has an end too.
+    std::vector<int> mCodePointStarts;
+    std::vector<int> mCodePoints;
+    std::vector<int> mProbabilities;
+    std::vector<int> mChildrenPositions;
+    std::vector<int> mChildrenCounts;
+    std::vector<int> mFirstChildIndices;
+    std::vector<int> mAttributesPositions;
+    std::vector<int> mSiblingPositions;
+};
+} // namespace latinime
+#endif // LATINIME_FLAT_NODE_INDEX_H
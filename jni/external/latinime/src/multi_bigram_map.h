@@ -21,8 +21,8 @@
 #include <stdint.h>
 
 #include "defines.h"
+#include "bigram_hash_map.h"
 #include "binary_format.h"
-#include "hash_map_compat.h"
 
 namespace latinime {
 
@@ -31,59 +31,57 @@ namespace latinime {
 // multi-word suggestion.
 class MultiBigramMap {
  public:
-    MultiBigramMap() : mBigramMaps() {}
-    ~MultiBigramMap() {}
+    MultiBigramMap() : mBigramMapIndices(MAX_CACHED_PREV_WORDS_IN_BIGRAM_MAP), mBigramMaps(),
+            mBigramMapCount(0) {}
+    ~MultiBigramMap() {
+        for (int i = 0; i < mBigramMapCount; ++i) {
+            delete mBigramMaps[i];
+        }
+    }
 
     // Look up the bigram probability for the given word pair from the cached bigram maps.
     // Also caches the bigrams if there is space remaining and they have not been cached already.
     int getBigramProbability(const uint8_t *const dicRoot, const int wordPosition,
             const int nextWordPosition, const int unigramProbability) {
-        hash_map_compat<int, BigramMap>::const_iterator mapPosition =
-                mBigramMaps.find(wordPosition);
-        if (mapPosition != mBigramMaps.end()) {
-            return mapPosition->second.getBigramProbability(nextWordPosition, unigramProbability);
+        int index;
+        if (mBigramMapIndices.find(wordPosition, &index)) {
+            return BinaryFormat::getProbability(
+                    nextWordPosition, mBigramMaps[index], unigramProbability);
         }
-        if (mBigramMaps.size() < MAX_CACHED_PREV_WORDS_IN_BIGRAM_MAP) {
-            addBigramsForWordPosition(dicRoot, wordPosition);
-            return mBigramMaps[wordPosition].getBigramProbability(
-                    nextWordPosition, unigramProbability);
+        if (mBigramMapIndices.size() < MAX_CACHED_PREV_WORDS_IN_BIGRAM_MAP) {
+            BigramHashMap *const bigramMap = addBigramsForWordPosition(dicRoot, wordPosition);
+            return BinaryFormat::getProbability(nextWordPosition, bigramMap, unigramProbability);
         }
         return BinaryFormat::getBigramProbability(
                 dicRoot, wordPosition, nextWordPosition, unigramProbability);
     }
 
+    // The maps themselves are kept to be filled again.
     void clear() {
-        mBigramMaps.clear();
+        mBigramMapIndices.clear();
     }
 
  private:
     DISALLOW_COPY_AND_ASSIGN(MultiBigramMap);
 
-    class BigramMap {
-     public:
-        BigramMap() : mBigramMap(DEFAULT_HASH_MAP_SIZE_FOR_EACH_BIGRAM_MAP) {}
-        ~BigramMap() {}
-
-        void init(const uint8_t *const dicRoot, int position) {
-            BinaryFormat::fillBigramProbabilityToHashMap(dicRoot, position, &mBigramMap);
+    BigramHashMap *addBigramsForWordPosition(const uint8_t *const dicRoot, const int position) {
+        const int index = mBigramMapIndices.size();
+        if (index == mBigramMapCount) {
+            mBigramMaps[mBigramMapCount++] =
+                    new BigramHashMap(DEFAULT_HASH_MAP_SIZE_FOR_EACH_BIGRAM_MAP);
         }
-
-        inline int getBigramProbability(const int nextWordPosition, const int unigramProbability)
-                const {
-           return BinaryFormat::getBigramProbabilityFromHashMap(
-                   nextWordPosition, &mBigramMap, unigramProbability);
-        }
-
-     private:
-        // Note: Default copy constructor needed for use in hash_map.
-        hash_map_compat<int, int> mBigramMap;
-    };
-
-    void addBigramsForWordPosition(const uint8_t *const dicRoot, const int position) {
-        mBigramMaps[position].init(dicRoot, position);
+        BigramHashMap *const bigramMap = mBigramMaps[index];
+        bigramMap->clear();
+        BinaryFormat::fillBigramProbabilityToHashMap(dicRoot, position, bigramMap);
+        mBigramMapIndices.put(position, index);
+        return bigramMap;
     }
 
-    hash_map_compat<int, BigramMap> mBigramMaps;
+    // The previous word position to the index of its bigrams in mBigramMaps
+    BigramHashMap mBigramMapIndices;
+    BigramHashMap *mBigramMaps[MAX_CACHED_PREV_WORDS_IN_BIGRAM_MAP];
+    // Maps allocated so far, which the indices hand out again after a clear
+    int mBigramMapCount;
 };
 } // namespace latinime
 #endif // LATINIME_MULTI_BIGRAM_MAP_H
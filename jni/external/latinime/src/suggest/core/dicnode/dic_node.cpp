@@ -23,8 +23,8 @@ DicNode::DicNode(const DicNode &dicNode)
 #if DEBUG_DICT
           mProfiler(dicNode.mProfiler),
 #endif
+          mIsUsed(dicNode.mIsUsed), mIsCachedForNextSuggestion(dicNode.mIsCachedForNextSuggestion),
           mDicNodeProperties(dicNode.mDicNodeProperties), mDicNodeState(dicNode.mDicNodeState),
-          mIsCachedForNextSuggestion(dicNode.mIsCachedForNextSuggestion), mIsUsed(dicNode.mIsUsed),
           mReleaseListener(0) {
     /* empty */
 }
@@ -27,14 +27,16 @@
 
 #if DEBUG_DICT
 #define LOGI_SHOW_ADD_COST_PROP \
-        do { char charBuf[50]; \
-        INTS_TO_CHARS(getOutputWordBuf(), getDepth(), charBuf); \
+        do { char charBuf[50]; int wordBuf[MAX_WORD_LENGTH]; \
+        getOutputCodePoints(wordBuf); \
+        INTS_TO_CHARS(wordBuf, getDepth(), charBuf); \
         AKLOGI("%20s, \"%c\", size = %03d, total = %03d, index(0) = %02d, dist = %.4f, %s,,", \
                 __FUNCTION__, getNodeCodePoint(), inputSize, getTotalInputIndex(), \
                 getInputIndex(0), getNormalizedCompoundDistance(), charBuf); } while (0)
 #define DUMP_WORD_AND_SCORE(header) \
-        do { char charBuf[50]; char prevWordCharBuf[50]; \
-        INTS_TO_CHARS(getOutputWordBuf(), getDepth(), charBuf); \
+        do { char charBuf[50]; char prevWordCharBuf[50]; int wordBuf[MAX_WORD_LENGTH]; \
+        getOutputCodePoints(wordBuf); \
+        INTS_TO_CHARS(wordBuf, getDepth(), charBuf); \
         INTS_TO_CHARS(mDicNodeState.mDicNodeStatePrevWord.mPrevWord, \
                 mDicNodeState.mDicNodeStatePrevWord.getPrevWordLength(), prevWordCharBuf); \
         AKLOGI("#%8s, %5f, %5f, %5f, %5f, %s, %s, %d,,", header, \
@@ -85,8 +87,8 @@ class DicNode {
 #if DEBUG_DICT
               mProfiler(),
 #endif
-              mDicNodeProperties(), mDicNodeState(), mIsCachedForNextSuggestion(false),
-              mIsUsed(false), mReleaseListener(0) {}
+              mIsUsed(false), mIsCachedForNextSuggestion(false), mDicNodeProperties(),
+              mDicNodeState(), mReleaseListener(0) {}
 
     DicNode(const DicNode &dicNode);
     DicNode &operator=(const DicNode &dicNode);
@@ -104,13 +106,14 @@ class DicNode {
 
     // TODO: minimize arguments by looking binary_format
     // Init for root with prevWordNodePos which is used for bigram
-    void initAsRoot(const int pos, const int childrenPos, const int childrenCount,
-            const int prevWordNodePos) {
+    void initAsRoot(const int pos, const int childrenPos, const int childrenIndex,
+            const int childrenCount, const int prevWordNodePos,
+            DicNodeWordArena *const wordArena) {
         mIsUsed = true;
         mIsCachedForNextSuggestion = false;
-        mDicNodeProperties.init(
-                pos, 0, childrenPos, 0, 0, 0, childrenCount, 0, 0, false, false, true, 0, 0);
-        mDicNodeState.init(prevWordNodePos);
+        mDicNodeProperties.init(pos, 0, childrenPos, childrenIndex, 0, 0, 0, childrenCount, 0, 0,
+                false, false, true, 0, 0);
+        mDicNodeState.init(prevWordNodePos, wordArena);
         PROF_NODE_RESET(mProfiler);
     }
 
@@ -126,13 +129,17 @@ class DicNode {
     // TODO: minimize arguments by looking binary_format
     // Init for root with previous word
     void initAsRootWithPreviousWord(DicNode *dicNode, const int pos, const int childrenPos,
-            const int childrenCount) {
+            const int childrenIndex, const int childrenCount) {
         mIsUsed = true;
         mIsCachedForNextSuggestion = false;
-        mDicNodeProperties.init(
-                pos, 0, childrenPos, 0, 0, 0, childrenCount, 0, 0, false, false, true, 0, 0);
+        mDicNodeProperties.init(pos, 0, childrenPos, childrenIndex, 0, 0, 0, childrenCount, 0, 0,
+                false, false, true, 0, 0);
         // TODO: Move to dicNodeState?
-        mDicNodeState.mDicNodeStateOutput.init(); // reset for next word
+        // reset for next word
+        mDicNodeState.mDicNodeStateOutput.init(
+                dicNode->mDicNodeState.mDicNodeStateOutput.getArena());
+        int prevWordLastBuf[MAX_WORD_LENGTH];
+        dicNode->getOutputCodePoints(prevWordLastBuf);
         mDicNodeState.mDicNodeStateInput.init(
                 &dicNode->mDicNodeState.mDicNodeStateInput, true /* resetTerminalDiffCost */);
         mDicNodeState.mDicNodeStateScoring.init(
@@ -143,7 +150,7 @@ class DicNode {
                 dicNode->mDicNodeProperties.getPos(),
                 dicNode->mDicNodeState.mDicNodeStatePrevWord.mPrevWord,
                 dicNode->mDicNodeState.mDicNodeStatePrevWord.getPrevWordLength(),
-                dicNode->getOutputWordBuf(),
+                prevWordLastBuf,
                 dicNode->mDicNodeProperties.getDepth(),
                 dicNode->mDicNodeState.mDicNodeStatePrevWord.mPrevSpacePositions,
                 mDicNodeState.mDicNodeStateInput.getInputIndex(0) /* lastInputIndex */);
@@ -152,18 +159,19 @@ class DicNode {
 
     // TODO: minimize arguments by looking binary_format
     void initAsChild(DicNode *dicNode, const int pos, const uint8_t flags, const int childrenPos,
-            const int attributesPos, const int siblingPos, const int nodeCodePoint,
-            const int childrenCount, const int probability, const int bigramProbability,
-            const bool isTerminal, const bool hasMultipleChars, const bool hasChildren,
-            const uint16_t additionalSubwordLength, const int *additionalSubword) {
+            const int childrenIndex, const int attributesPos, const int siblingPos,
+            const int nodeCodePoint, const int childrenCount, const int probability,
+            const int bigramProbability, const bool isTerminal, const bool hasMultipleChars,
+            const bool hasChildren, const uint16_t additionalSubwordLength,
+            const int *additionalSubword) {
         mIsUsed = true;
         uint16_t newDepth = static_cast<uint16_t>(dicNode->getDepth() + 1);
         mIsCachedForNextSuggestion = dicNode->mIsCachedForNextSuggestion;
         const uint16_t newLeavingDepth = static_cast<uint16_t>(
                 dicNode->mDicNodeProperties.getLeavingDepth() + additionalSubwordLength);
-        mDicNodeProperties.init(pos, flags, childrenPos, attributesPos, siblingPos, nodeCodePoint,
-                childrenCount, probability, bigramProbability, isTerminal, hasMultipleChars,
-                hasChildren, newDepth, newLeavingDepth);
+        mDicNodeProperties.init(pos, flags, childrenPos, childrenIndex, attributesPos, siblingPos,
+                nodeCodePoint, childrenCount, probability, bigramProbability, isTerminal,
+                hasMultipleChars, hasChildren, newDepth, newLeavingDepth);
         mDicNodeState.init(&dicNode->mDicNodeState, additionalSubwordLength, additionalSubword);
         PROF_NODE_COPY(&dicNode->mProfiler, mProfiler);
     }
@@ -220,7 +228,7 @@ class DicNode {
     }
 
     bool isFirstCharUppercase() const {
-        const int c = getOutputWordBuf()[0];
+        const int c = getFirstCodePoint();
         return isAsciiUpper(c);
     }
 
@@ -251,6 +259,11 @@ class DicNode {
         return mDicNodeProperties.getChildrenPos();
     }
 
+    // Used in DicNodeUtils
+    int getChildrenIndex() const {
+        return mDicNodeProperties.getChildrenIndex();
+    }
+
     // Used in DicNodeUtils
     int getChildrenCount() const {
         return mDicNodeProperties.getChildrenCount();
@@ -317,8 +330,10 @@ class DicNode {
     void outputResult(int *dest) const {
         const uint16_t prevWordLength = mDicNodeState.mDicNodeStatePrevWord.getPrevWordLength();
         const uint16_t currentDepth = getDepth();
+        int wordBuf[MAX_WORD_LENGTH];
+        getOutputCodePoints(wordBuf);
         DicNodeUtils::appendTwoWords(mDicNodeState.mDicNodeStatePrevWord.mPrevWord,
-                   prevWordLength, getOutputWordBuf(), currentDepth, dest);
+                   prevWordLength, wordBuf, currentDepth, dest);
         DUMP_WORD_AND_SCORE("OUTPUT");
     }
 
@@ -364,8 +379,13 @@ class DicNode {
         return mDicNodeState.mDicNodeStatePrevWord.getPrevWordNodePos();
     }
 
-    AK_FORCE_INLINE const int *getOutputWordBuf() const {
-        return mDicNodeState.mDicNodeStateOutput.mWordBuf;
+    // Writes the getDepth() code points of the word so far to |dest|.
+    AK_FORCE_INLINE void getOutputCodePoints(int *const dest) const {
+        mDicNodeState.mDicNodeStateOutput.getCodePoints(getDepth(), dest);
+    }
+
+    int getFirstCodePoint() const {
+        return mDicNodeState.mDicNodeStateOutput.getCodePointAt(0);
     }
 
     int getPrevCodePointG(int pointerId) const {
@@ -516,23 +536,23 @@ class DicNode {
         if (depthDiff != 0) {
             return depthDiff > 0;
         }
-        for (int i = 0; i < depth; ++i) {
-            const int codePoint = mDicNodeState.mDicNodeStateOutput.getCodePointAt(i);
-            const int rightCodePoint = right->mDicNodeState.mDicNodeStateOutput.getCodePointAt(i);
-            if (codePoint != rightCodePoint) {
-                return rightCodePoint > codePoint;
-            }
+        const int codePointDiff = mDicNodeState.mDicNodeStateOutput.compareCodePoints(
+                &right->mDicNodeState.mDicNodeStateOutput, depth);
+        if (codePointDiff != 0) {
+            return codePointDiff < 0;
         }
         // Compare pointer values here for stable comparison
         return this > right;
     }
 
  private:
-    DicNodeProperties mDicNodeProperties;
-    DicNodeState mDicNodeState;
+    // compare() reads the flags, the depth and the normalized compound distance of every node
+    // the queues hold, which this order keeps within the first few words of the node.
+    bool mIsUsed;
     // TODO: Remove
     bool mIsCachedForNextSuggestion;
-    bool mIsUsed;
+    DicNodeProperties mDicNodeProperties;
+    DicNodeState mDicNodeState;
     DicNodeReleaseListener *mReleaseListener;
 
     AK_FORCE_INLINE int getTotalInputIndex() const {
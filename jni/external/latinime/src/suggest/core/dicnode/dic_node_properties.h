@@ -30,23 +30,24 @@ namespace latinime {
 class DicNodeProperties {
  public:
     AK_FORCE_INLINE DicNodeProperties()
-            : mPos(0), mFlags(0), mChildrenPos(0), mAttributesPos(0), mSiblingPos(0),
-              mChildrenCount(0), mProbability(0), mBigramProbability(0), mNodeCodePoint(0),
-              mDepth(0), mLeavingDepth(0), mIsTerminal(false), mHasMultipleChars(false),
-              mHasChildren(false) {
+            : mDepth(0), mLeavingDepth(0), mPos(0), mChildrenPos(0),
+              mChildrenIndex(NOT_AN_INDEX), mAttributesPos(0), mSiblingPos(0), mChildrenCount(0),
+              mProbability(0), mBigramProbability(0), mNodeCodePoint(0), mFlags(0),
+              mIsTerminal(false), mHasMultipleChars(false), mHasChildren(false) {
     }
 
-    virtual ~DicNodeProperties() {}
+    ~DicNodeProperties() {}
 
     // Should be called only once per DicNode is initialized.
-    void init(const int pos, const uint8_t flags, const int childrenPos, const int attributesPos,
-            const int siblingPos, const int nodeCodePoint, const int childrenCount,
-            const int probability, const int bigramProbability, const bool isTerminal,
-            const bool hasMultipleChars, const bool hasChildren, const uint16_t depth,
-            const uint16_t terminalDepth) {
+    void init(const int pos, const uint8_t flags, const int childrenPos, const int childrenIndex,
+            const int attributesPos, const int siblingPos, const int nodeCodePoint,
+            const int childrenCount, const int probability, const int bigramProbability,
+            const bool isTerminal, const bool hasMultipleChars, const bool hasChildren,
+            const uint16_t depth, const uint16_t terminalDepth) {
         mPos = pos;
         mFlags = flags;
         mChildrenPos = childrenPos;
+        mChildrenIndex = childrenIndex;
         mAttributesPos = attributesPos;
         mSiblingPos = siblingPos;
         mNodeCodePoint = nodeCodePoint;
@@ -65,6 +66,7 @@ class DicNodeProperties {
         mPos = nodeProp->mPos;
         mFlags = nodeProp->mFlags;
         mChildrenPos = nodeProp->mChildrenPos;
+        mChildrenIndex = nodeProp->mChildrenIndex;
         mAttributesPos = nodeProp->mAttributesPos;
         mSiblingPos = nodeProp->mSiblingPos;
         mNodeCodePoint = nodeProp->mNodeCodePoint;
@@ -83,6 +85,7 @@ class DicNodeProperties {
         mPos = nodeProp->mPos;
         mFlags = nodeProp->mFlags;
         mChildrenPos = nodeProp->mChildrenPos;
+        mChildrenIndex = nodeProp->mChildrenIndex;
         mAttributesPos = nodeProp->mAttributesPos;
         mSiblingPos = nodeProp->mSiblingPos;
         mNodeCodePoint = codePoint; // Overwrite the node char of a passing child
@@ -108,6 +111,11 @@ class DicNodeProperties {
         return mChildrenPos;
     }
 
+    // Where the children start in the dictionary's FlatNodeIndex, NOT_AN_INDEX without one
+    int getChildrenIndex() const {
+        return mChildrenIndex;
+    }
+
     int getAttributesPos() const {
         return mAttributesPos;
     }
@@ -159,17 +167,20 @@ class DicNodeProperties {
         return mSiblingPos;
     }
 
+    // The depths come first as every comparison of two nodes reads them, and the small fields go
+    // last so that there is no padding in between.
+    uint16_t mDepth;
+    uint16_t mLeavingDepth;
     int mPos;
-    uint8_t mFlags;
     int mChildrenPos;
+    int mChildrenIndex;
     int mAttributesPos;
     int mSiblingPos;
     int mChildrenCount;
     int mProbability;
     int mBigramProbability; // not used for now
     int mNodeCodePoint;
-    uint16_t mDepth;
-    uint16_t mLeavingDepth;
+    uint8_t mFlags;
     bool mIsTerminal;
     bool mHasMultipleChars;
     bool mHasChildren;
@@ -27,22 +27,24 @@ namespace latinime {
 
 class DicNodeState {
  public:
+    // Ordered by how often they are read, so that the scores, the input indices and the output
+    // word sit next to the node properties and the bulky previous words come last.
+    DicNodeStateScoring mDicNodeStateScoring;
     DicNodeStateInput mDicNodeStateInput;
     DicNodeStateOutput mDicNodeStateOutput;
     DicNodeStatePrevWord mDicNodeStatePrevWord;
-    DicNodeStateScoring mDicNodeStateScoring;
 
     AK_FORCE_INLINE DicNodeState()
-            : mDicNodeStateInput(), mDicNodeStateOutput(), mDicNodeStatePrevWord(),
-              mDicNodeStateScoring() {
+            : mDicNodeStateScoring(), mDicNodeStateInput(), mDicNodeStateOutput(),
+              mDicNodeStatePrevWord() {
     }
 
-    virtual ~DicNodeState() {}
+    ~DicNodeState() {}
 
-    // Init with prevWordPos
-    void init(const int prevWordPos) {
+    // Init with prevWordPos and the arena to spell out words in
+    void init(const int prevWordPos, DicNodeWordArena *const wordArena) {
         mDicNodeStateInput.init();
-        mDicNodeStateOutput.init();
+        mDicNodeStateOutput.init(wordArena);
         mDicNodeStatePrevWord.init(prevWordPos);
         mDicNodeStateScoring.init();
     }
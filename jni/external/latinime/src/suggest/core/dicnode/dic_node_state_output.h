@@ -17,58 +17,112 @@
 #ifndef LATINIME_DIC_NODE_STATE_OUTPUT_H
 #define LATINIME_DIC_NODE_STATE_OUTPUT_H
 
-#include <cstring> // for memcpy()
 #include <stdint.h>
 
 #include "defines.h"
+#include "dic_node_word_arena.h"
 
 namespace latinime {
 
+// The word a node has spelled out so far, as a link into the session's word arena. Copying one
+// costs three words however long the word is.
 class DicNodeStateOutput {
  public:
-    DicNodeStateOutput() : mOutputtedLength(0) {
-        init();
+    DicNodeStateOutput()
+            : mArena(0), mTail(DicNodeWordArena::NOT_A_LINK), mOutputtedLength(0) {}
+
+    // Copies share the arena, as copies of the node do.
+    DicNodeStateOutput(const DicNodeStateOutput &stateOutput)
+            : mArena(stateOutput.mArena), mTail(stateOutput.mTail),
+              mOutputtedLength(stateOutput.mOutputtedLength) {}
+
+    DicNodeStateOutput &operator=(const DicNodeStateOutput &stateOutput) {
+        init(&stateOutput);
+        return *this;
     }
 
-    virtual ~DicNodeStateOutput() {}
+    ~DicNodeStateOutput() {}
 
-    void init() {
+    void init(DicNodeWordArena *const arena) {
+        mArena = arena;
+        mTail = DicNodeWordArena::NOT_A_LINK;
         mOutputtedLength = 0;
-        mWordBuf[0] = 0;
     }
 
     void init(const DicNodeStateOutput *const stateOutput) {
-        memcpy(mWordBuf, stateOutput->mWordBuf,
-                stateOutput->mOutputtedLength * sizeof(mWordBuf[0]));
+        mArena = stateOutput->mArena;
+        mTail = stateOutput->mTail;
         mOutputtedLength = stateOutput->mOutputtedLength;
-        if (mOutputtedLength < MAX_WORD_LENGTH) {
-            mWordBuf[mOutputtedLength] = 0;
-        }
     }
 
     void addSubword(const uint16_t additionalSubwordLength, const int *const additionalSubword) {
         if (additionalSubword) {
-            memcpy(&mWordBuf[mOutputtedLength], additionalSubword,
-                    additionalSubwordLength * sizeof(mWordBuf[0]));
+            mTail = mArena->append(mTail, additionalSubword, additionalSubwordLength);
             mOutputtedLength = static_cast<uint16_t>(mOutputtedLength + additionalSubwordLength);
-            if (mOutputtedLength < MAX_WORD_LENGTH) {
-                mWordBuf[mOutputtedLength] = 0;
-            }
         }
     }
 
-    // TODO: Remove
+    DicNodeWordArena *getArena() const {
+        return mArena;
+    }
+
+    // Returns 0 past the end of the word, as the terminator of a buffer would.
     int getCodePointAt(const int id) const {
-        return mWordBuf[id];
+        if (id < 0 || id >= mOutputtedLength) {
+            return 0;
+        }
+        int link = mTail;
+        for (int i = mOutputtedLength - 1; i > id; --i) {
+            link = mArena->getParent(link);
+        }
+        return mArena->getCodePoint(link);
     }
 
-    // TODO: Move to private
-    int mWordBuf[MAX_WORD_LENGTH];
+    // Writes the first |length| code points of the word to |dest|.
+    void getCodePoints(const int length, int *const dest) const {
+        int link = mTail;
+        for (int i = mOutputtedLength - 1; i >= 0; --i) {
+            if (i < length) {
+                dest[i] = mArena->getCodePoint(link);
+            }
+            link = mArena->getParent(link);
+        }
+        for (int i = mOutputtedLength; i < length; ++i) {
+            dest[i] = 0;
+        }
+    }
+
+    // Compares the first |length| code points of both words, which must come from the same
+    // arena, and returns which is greater. The walk stops where the two words start sharing
+    // their links, so nodes of the same branch compare in a few steps.
+    int compareCodePoints(const DicNodeStateOutput *const right, const int length) const {
+        int link = skipLinks(mTail, mOutputtedLength - length);
+        int rightLink = skipLinks(right->mTail, right->mOutputtedLength - length);
+        int diff = 0;
+        while (link != rightLink && link != DicNodeWordArena::NOT_A_LINK
+                && rightLink != DicNodeWordArena::NOT_A_LINK) {
+            const int codePoint = mArena->getCodePoint(link);
+            const int rightCodePoint = mArena->getCodePoint(rightLink);
+            if (codePoint != rightCodePoint) {
+                // Going backwards, so the last difference found is the first in the word.
+                diff = codePoint < rightCodePoint ? -1 : 1;
+            }
+            link = mArena->getParent(link);
+            rightLink = mArena->getParent(rightLink);
+        }
+        return diff;
+    }
 
  private:
-    // Caution!!!
-    // Use a default copy constructor and an assign operator because shallow copies are ok
-    // for this class
+    int skipLinks(int link, const int count) const {
+        for (int i = 0; i < count; ++i) {
+            link = mArena->getParent(link);
+        }
+        return link;
+    }
+
+    DicNodeWordArena *mArena;
+    int mTail;
     uint16_t mOutputtedLength;
 };
 } // namespace latinime
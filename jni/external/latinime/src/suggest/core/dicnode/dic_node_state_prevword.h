@@ -34,7 +34,7 @@ class DicNodeStatePrevWord {
         memset(mPrevSpacePositions, 0, sizeof(mPrevSpacePositions));
     }
 
-    virtual ~DicNodeStatePrevWord() {}
+    ~DicNodeStatePrevWord() {}
 
     void init() {
         mPrevWordLength = 0;
@@ -62,7 +62,9 @@ class DicNodeStatePrevWord {
         mPrevWordProbability = prevWord->mPrevWordProbability;
         mPrevWordNodePos = prevWord->mPrevWordNodePos;
         memcpy(mPrevWord, prevWord->mPrevWord, prevWord->mPrevWordLength * sizeof(mPrevWord[0]));
-        memcpy(mPrevSpacePositions, prevWord->mPrevSpacePositions, sizeof(mPrevSpacePositions));
+        // Only the positions of the words so far mean anything, see outputSpacePositions().
+        memcpy(mPrevSpacePositions, prevWord->mPrevSpacePositions,
+                prevWord->mPrevWordCount * sizeof(mPrevSpacePositions[0]));
     }
 
     void init(const int16_t prevWordCount, const int16_t prevWordProbability,
@@ -77,7 +79,8 @@ class DicNodeStatePrevWord {
         mPrevWord[twoWordsLen] = KEYCODE_SPACE;
         mPrevWordStart = length0;
         mPrevWordLength = static_cast<int16_t>(twoWordsLen + 1);
-        memcpy(mPrevSpacePositions, prevSpacePositions, sizeof(mPrevSpacePositions));
+        memcpy(mPrevSpacePositions, prevSpacePositions,
+                (mPrevWordCount - 1) * sizeof(mPrevSpacePositions[0]));
         mPrevSpacePositions[mPrevWordCount - 1] = lastInputIndex;
     }
 
@@ -96,7 +99,7 @@ class DicNodeStatePrevWord {
     void outputSpacePositions(int *spaceIndices) const {
         // Convert uint16_t to int
         for (int i = 0; i < MAX_RESULTS; i++) {
-            spaceIndices[i] = mPrevSpacePositions[i];
+            spaceIndices[i] = i < mPrevWordCount ? mPrevSpacePositions[i] : 0;
         }
     }
 
@@ -27,14 +27,13 @@ namespace latinime {
 class DicNodeStateScoring {
  public:
     AK_FORCE_INLINE DicNodeStateScoring()
-            : mDoubleLetterLevel(NOT_A_DOUBLE_LETTER),
+            : mNormalizedCompoundDistance(0.0f), mSpatialDistance(0.0f), mLanguageDistance(0.0f),
+              mRawLength(0.0f), mDoubleLetterLevel(NOT_A_DOUBLE_LETTER),
               mDigraphIndex(DigraphUtils::NOT_A_DIGRAPH_INDEX),
-              mEditCorrectionCount(0), mProximityCorrectionCount(0),
-              mNormalizedCompoundDistance(0.0f), mSpatialDistance(0.0f), mLanguageDistance(0.0f),
-              mRawLength(0.0f), mExactMatch(true) {
+              mEditCorrectionCount(0), mProximityCorrectionCount(0), mExactMatch(true) {
     }
 
-    virtual ~DicNodeStateScoring() {}
+    ~DicNodeStateScoring() {}
 
     void init() {
         mEditCorrectionCount = 0;
@@ -167,16 +166,17 @@ class DicNodeStateScoring {
     // Caution!!!
     // Use a default copy constructor and an assign operator because shallow copies are ok
     // for this class
+    // What the priority queues order the nodes by, right after the properties of the node.
+    float mNormalizedCompoundDistance;
+    float mSpatialDistance;
+    float mLanguageDistance;
+    float mRawLength;
+
     DoubleLetterLevel mDoubleLetterLevel;
     DigraphUtils::DigraphCodePointIndex mDigraphIndex;
 
     int16_t mEditCorrectionCount;
     int16_t mProximityCorrectionCount;
-
-    float mNormalizedCompoundDistance;
-    float mSpatialDistance;
-    float mLanguageDistance;
-    float mRawLength;
     bool mExactMatch;
 
     AK_FORCE_INLINE void addDistance(float spatialDistance, float languageDistance,
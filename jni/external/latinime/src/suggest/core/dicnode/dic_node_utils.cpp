@@ -21,6 +21,7 @@
 #include "dic_node.h"
 #include "dic_node_utils.h"
 #include "dic_node_vector.h"
+#include "flat_node_index.h"
 #include "multi_bigram_map.h"
 #include "proximity_info.h"
 #include "proximity_info_state.h"
@@ -32,21 +33,31 @@ namespace latinime {
 ///////////////////////////////
 
 /* static */ void DicNodeUtils::initAsRoot(const int rootPos, const uint8_t *const dicRoot,
-        const int prevWordNodePos, DicNode *newRootNode) {
+        const FlatNodeIndex *const flatNodeIndex, const int prevWordNodePos,
+        DicNodeWordArena *const wordArena, DicNode *newRootNode) {
     int curPos = rootPos;
     const int pos = curPos;
     const int childrenCount = BinaryFormat::getGroupCountAndForwardPointer(dicRoot, &curPos);
     const int childrenPos = curPos;
-    newRootNode->initAsRoot(pos, childrenPos, childrenCount, prevWordNodePos);
+    newRootNode->initAsRoot(pos, childrenPos, getRootChildrenIndex(rootPos, flatNodeIndex),
+            childrenCount, prevWordNodePos, wordArena);
 }
 
 /*static */ void DicNodeUtils::initAsRootWithPreviousWord(const int rootPos,
-        const uint8_t *const dicRoot, DicNode *prevWordLastNode, DicNode *newRootNode) {
+        const uint8_t *const dicRoot, const FlatNodeIndex *const flatNodeIndex,
+        DicNode *prevWordLastNode, DicNode *newRootNode) {
     int curPos = rootPos;
     const int pos = curPos;
     const int childrenCount = BinaryFormat::getGroupCountAndForwardPointer(dicRoot, &curPos);
     const int childrenPos = curPos;
-    newRootNode->initAsRootWithPreviousWord(prevWordLastNode, pos, childrenPos, childrenCount);
+    newRootNode->initAsRootWithPreviousWord(prevWordLastNode, pos, childrenPos,
+            getRootChildrenIndex(rootPos, flatNodeIndex), childrenCount);
+}
+
+// The index is built from the root of the dictionary, at 0.
+/* static */ int DicNodeUtils::getRootChildrenIndex(const int rootPos,
+        const FlatNodeIndex *const flatNodeIndex) {
+    return flatNodeIndex && rootPos == 0 ? FlatNodeIndex::ROOT_CHILDREN_INDEX : NOT_AN_INDEX;
 }
 
 /* static */ void DicNodeUtils::initByCopy(DicNode *srcNode, DicNode *destNode) {
@@ -112,12 +123,39 @@ namespace latinime {
     }
     const int childrenCount = hasChildren
             ? BinaryFormat::getGroupCountAndForwardPointer(dicRoot, &childrenPos) : 0;
-    childDicNodes->pushLeavingChild(dicNode, nextPos, flags, childrenPos, attributesPos, siblingPos,
-            nodeCodePoint, childrenCount, probability, -1 /* bigramProbability */, isTerminal,
-            hasMultipleChars, hasChildren, additionalSubwordLength, additionalWordBuf);
+    childDicNodes->pushLeavingChild(dicNode, nextPos, flags, childrenPos, NOT_AN_INDEX,
+            attributesPos, siblingPos, nodeCodePoint, childrenCount, probability,
+            -1 /* bigramProbability */, isTerminal, hasMultipleChars, hasChildren,
+            additionalSubwordLength, additionalWordBuf);
     return siblingPos;
 }
 
+// Same as createAndGetLeavingChildNode, for the child at |index| in |flatNodeIndex|.
+/* static */ void DicNodeUtils::createAndGetIndexedLeavingChildNode(DicNode *dicNode,
+        const FlatNodeIndex *const flatNodeIndex, const int index,
+        const ProximityInfoState *pInfoState, const int pointIndex, const bool exactOnly,
+        const std::vector<int> *const codePointsFilter, const ProximityInfo *const pInfo,
+        DicNodeVector *childDicNodes) {
+    const int nodeCodePoint = flatNodeIndex->getCodePoint(index);
+    if (isDicNodeFilteredOut(nodeCodePoint, pInfo, codePointsFilter)) {
+        return;
+    }
+    if (!isMatchedNodeCodePoint(pInfoState, pointIndex, exactOnly, nodeCodePoint)) {
+        return;
+    }
+    const uint8_t flags = flatNodeIndex->getFlags(index);
+    childDicNodes->pushLeavingChild(dicNode, flatNodeIndex->getPosition(index), flags,
+            flatNodeIndex->getChildrenPosition(index), flatNodeIndex->getFirstChildIndex(index),
+            flatNodeIndex->getAttributesPosition(index), flatNodeIndex->getSiblingPosition(index),
+            nodeCodePoint,
+            flatNodeIndex->getChildrenCount(index), flatNodeIndex->getProbability(index),
+            -1 /* bigramProbability */, 0 != (BinaryFormat::FLAG_IS_TERMINAL & flags),
+            0 != (BinaryFormat::FLAG_HAS_MULTIPLE_CHARS & flags),
+            BinaryFormat::hasChildrenInFlags(flags),
+            static_cast<uint16_t>(flatNodeIndex->getCodePointCount(index)),
+            flatNodeIndex->getCodePoints(index));
+}
+
 /* static */ bool DicNodeUtils::isDicNodeFilteredOut(const int nodeCodePoint,
         const ProximityInfo *const pInfo, const std::vector<int> *const codePointsFilter) {
     const int filterSize = codePointsFilter ? codePointsFilter->size() : 0;
@@ -147,11 +185,27 @@ namespace latinime {
 }
 
 /* static */ void DicNodeUtils::createAndGetAllLeavingChildNodes(DicNode *dicNode,
-        const uint8_t *const dicRoot, const ProximityInfoState *pInfoState, const int pointIndex,
-        const bool exactOnly, const std::vector<int> *const codePointsFilter,
-        const ProximityInfo *const pInfo, DicNodeVector *childDicNodes) {
-    const int terminalDepth = dicNode->getLeavingDepth();
+        const uint8_t *const dicRoot, const FlatNodeIndex *const flatNodeIndex,
+        const ProximityInfoState *pInfoState, const int pointIndex, const bool exactOnly,
+        const std::vector<int> *const codePointsFilter, const ProximityInfo *const pInfo,
+        DicNodeVector *childDicNodes) {
     const int childCount = dicNode->getChildrenCount();
+    const int firstChildIndex = dicNode->getChildrenIndex();
+    if (flatNodeIndex && firstChildIndex != NOT_AN_INDEX) {
+        // The children are the entries of a plain index range.
+        const int filterSize = codePointsFilter ? codePointsFilter->size() : 0;
+        const int endIndex = firstChildIndex + childCount;
+        for (int index = firstChildIndex; index < endIndex; ++index) {
+            createAndGetIndexedLeavingChildNode(dicNode, flatNodeIndex, index, pInfoState,
+                    pointIndex, exactOnly, codePointsFilter, pInfo, childDicNodes);
+            if (!pInfo && filterSize > 0 && childDicNodes->exceeds(filterSize)) {
+                // All code points have been found.
+                break;
+            }
+        }
+        return;
+    }
+    const int terminalDepth = dicNode->getLeavingDepth();
     int nextPos = dicNode->getChildrenPos();
     for (int i = 0; i < childCount; i++) {
         const int filterSize = codePointsFilter ? codePointsFilter->size() : 0;
@@ -165,13 +219,14 @@ namespace latinime {
 }
 
 /* static */ void DicNodeUtils::getAllChildDicNodes(DicNode *dicNode, const uint8_t *const dicRoot,
-        DicNodeVector *childDicNodes) {
-    getProximityChildDicNodes(dicNode, dicRoot, 0, 0, false, childDicNodes);
+        const FlatNodeIndex *const flatNodeIndex, DicNodeVector *childDicNodes) {
+    getProximityChildDicNodes(dicNode, dicRoot, flatNodeIndex, 0, 0, false, childDicNodes);
 }
 
 /* static */ void DicNodeUtils::getProximityChildDicNodes(DicNode *dicNode,
-        const uint8_t *const dicRoot, const ProximityInfoState *pInfoState, const int pointIndex,
-        bool exactOnly, DicNodeVector *childDicNodes) {
+        const uint8_t *const dicRoot, const FlatNodeIndex *const flatNodeIndex,
+        const ProximityInfoState *pInfoState, const int pointIndex, bool exactOnly,
+        DicNodeVector *childDicNodes) {
     if (dicNode->isTotalInputSizeExceedingLimit()) {
         return;
     }
@@ -179,8 +234,8 @@ namespace latinime {
         DicNodeUtils::createAndGetPassingChildNode(dicNode, pInfoState, pointIndex, exactOnly,
                 childDicNodes);
     } else {
-        DicNodeUtils::createAndGetAllLeavingChildNodes(dicNode, dicRoot, pInfoState, pointIndex,
-                exactOnly, 0 /* codePointsFilter */, 0 /* pInfo */,
+        DicNodeUtils::createAndGetAllLeavingChildNodes(dicNode, dicRoot, flatNodeIndex,
+                pInfoState, pointIndex, exactOnly, 0 /* codePointsFilter */, 0 /* pInfo */,
                 childDicNodes);
     }
 }
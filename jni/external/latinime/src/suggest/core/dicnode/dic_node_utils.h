@@ -26,6 +26,8 @@ namespace latinime {
 
 class DicNode;
 class DicNodeVector;
+class DicNodeWordArena;
+class FlatNodeIndex;
 class ProximityInfo;
 class ProximityInfoState;
 class MultiBigramMap;
@@ -35,20 +37,22 @@ class DicNodeUtils {
     static int appendTwoWords(const int *src0, const int16_t length0, const int *src1,
             const int16_t length1, int *dest);
     static void initAsRoot(const int rootPos, const uint8_t *const dicRoot,
-            const int prevWordNodePos, DicNode *newRootNode);
+            const FlatNodeIndex *const flatNodeIndex, const int prevWordNodePos,
+            DicNodeWordArena *const wordArena, DicNode *newRootNode);
     static void initAsRootWithPreviousWord(const int rootPos, const uint8_t *const dicRoot,
-            DicNode *prevWordLastNode, DicNode *newRootNode);
+            const FlatNodeIndex *const flatNodeIndex, DicNode *prevWordLastNode,
+            DicNode *newRootNode);
     static void initByCopy(DicNode *srcNode, DicNode *destNode);
     static void getAllChildDicNodes(DicNode *dicNode, const uint8_t *const dicRoot,
-            DicNodeVector *childDicNodes);
+            const FlatNodeIndex *const flatNodeIndex, DicNodeVector *childDicNodes);
     static float getBigramNodeImprobability(const uint8_t *const dicRoot,
             const DicNode *const node, MultiBigramMap *const multiBigramMap);
     static bool isDicNodeFilteredOut(const int nodeCodePoint, const ProximityInfo *const pInfo,
             const std::vector<int> *const codePointsFilter);
     // TODO: Move to private
     static void getProximityChildDicNodes(DicNode *dicNode, const uint8_t *const dicRoot,
-            const ProximityInfoState *pInfoState, const int pointIndex, bool exactOnly,
-            DicNodeVector *childDicNodes);
+            const FlatNodeIndex *const flatNodeIndex, const ProximityInfoState *pInfoState,
+            const int pointIndex, bool exactOnly, DicNodeVector *childDicNodes);
 
     // TODO: Move to proximity info
     static bool isProximityChar(ProximityType type) {
@@ -62,16 +66,23 @@ class DicNodeUtils {
 
     static int getBigramNodeProbability(const uint8_t *const dicRoot, const DicNode *const node,
             MultiBigramMap *multiBigramMap);
+    static int getRootChildrenIndex(const int rootPos, const FlatNodeIndex *const flatNodeIndex);
     static void createAndGetPassingChildNode(DicNode *dicNode, const ProximityInfoState *pInfoState,
             const int pointIndex, const bool exactOnly, DicNodeVector *childDicNodes);
     static void createAndGetAllLeavingChildNodes(DicNode *dicNode, const uint8_t *const dicRoot,
-            const ProximityInfoState *pInfoState, const int pointIndex, const bool exactOnly,
+            const FlatNodeIndex *const flatNodeIndex, const ProximityInfoState *pInfoState,
+            const int pointIndex, const bool exactOnly,
             const std::vector<int> *const codePointsFilter,
             const ProximityInfo *const pInfo, DicNodeVector *childDicNodes);
     static int createAndGetLeavingChildNode(DicNode *dicNode, int pos, const uint8_t *const dicRoot,
             const int terminalDepth, const ProximityInfoState *pInfoState, const int pointIndex,
             const bool exactOnly, const std::vector<int> *const codePointsFilter,
             const ProximityInfo *const pInfo, DicNodeVector *childDicNodes);
+    static void createAndGetIndexedLeavingChildNode(DicNode *dicNode,
+            const FlatNodeIndex *const flatNodeIndex, const int index,
+            const ProximityInfoState *pInfoState, const int pointIndex, const bool exactOnly,
+            const std::vector<int> *const codePointsFilter, const ProximityInfo *const pInfo,
+            DicNodeVector *childDicNodes);
 
     // TODO: Move to proximity info
     static bool isMatchedNodeCodePoint(const ProximityInfoState *pInfoState, const int pointIndex,
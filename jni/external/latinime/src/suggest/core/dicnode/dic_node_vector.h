@@ -17,13 +17,17 @@
 #ifndef LATINIME_DIC_NODE_VECTOR_H
 #define LATINIME_DIC_NODE_VECTOR_H
 
-#include <vector>
-
 #include "defines.h"
 #include "dic_node.h"
+#include "suggest/core/session/session_arena.h"
 
 namespace latinime {
 
+/**
+ * The children of a node while it is being expanded. They live in the session arena, which gets
+ * back everything the vector took when it goes out of scope, so vectors must be destroyed in the
+ * reverse order of their construction and must not grow while a younger one is alive.
+ */
 class DicNodeVector {
  public:
 #ifdef FLAG_DBG
@@ -32,64 +36,98 @@ class DicNodeVector {
 #else
     static const int DEFAULT_NODES_SIZE_FOR_OPTIMIZATION = 60;
 #endif
-    AK_FORCE_INLINE DicNodeVector() : mDicNodes(0), mLock(false), mEmptyNode() {}
+    AK_FORCE_INLINE explicit DicNodeVector(SessionArena *const arena)
+            : mArena(arena), mMark(arena->getMark()), mTop(mMark), mDicNodes(0), mSize(0),
+              mCapacity(0), mLock(false) {
+        reserve(MIN_CAPACITY);
+    }
 
     // Specify the capacity of the vector
-    AK_FORCE_INLINE DicNodeVector(const int size) : mDicNodes(0), mLock(false), mEmptyNode() {
-        mDicNodes.reserve(size);
+    AK_FORCE_INLINE DicNodeVector(SessionArena *const arena, const int size)
+            : mArena(arena), mMark(arena->getMark()), mTop(mMark), mDicNodes(0), mSize(0),
+              mCapacity(0), mLock(false) {
+        reserve(max(size, static_cast<int>(MIN_CAPACITY)));
     }
 
     // Non virtual inline destructor -- never inherit this class
-    AK_FORCE_INLINE ~DicNodeVector() {}
+    AK_FORCE_INLINE ~DicNodeVector() {
+        mArena->release(mMark);
+    }
 
     AK_FORCE_INLINE void clear() {
-        mDicNodes.clear();
+        mSize = 0;
         mLock = false;
     }
 
     int getSizeAndLock() {
         mLock = true;
-        return static_cast<int>(mDicNodes.size());
+        return mSize;
     }
 
     bool exceeds(const size_t limit) const {
-        return mDicNodes.size() >= limit;
+        return static_cast<size_t>(mSize) >= limit;
     }
 
     void pushPassingChild(DicNode *dicNode) {
         ASSERT(!mLock);
-        mDicNodes.push_back(mEmptyNode);
-        mDicNodes.back().initAsPassingChild(dicNode);
+        pushEmptyNode()->initAsPassingChild(dicNode);
     }
 
     void pushLeavingChild(DicNode *dicNode, const int pos, const uint8_t flags,
-            const int childrenPos, const int attributesPos, const int siblingPos,
-            const int nodeCodePoint, const int childrenCount, const int probability,
-            const int bigramProbability, const bool isTerminal, const bool hasMultipleChars,
-            const bool hasChildren, const uint16_t additionalSubwordLength,
-            const int *additionalSubword) {
+            const int childrenPos, const int childrenIndex, const int attributesPos,
+            const int siblingPos, const int nodeCodePoint, const int childrenCount,
+            const int probability, const int bigramProbability, const bool isTerminal,
+            const bool hasMultipleChars, const bool hasChildren,
+            const uint16_t additionalSubwordLength, const int *additionalSubword) {
         ASSERT(!mLock);
-        mDicNodes.push_back(mEmptyNode);
-        mDicNodes.back().initAsChild(dicNode, pos, flags, childrenPos, attributesPos, siblingPos,
-                nodeCodePoint, childrenCount, probability, -1 /* bigramProbability */, isTerminal,
-                hasMultipleChars, hasChildren, additionalSubwordLength, additionalSubword);
+        pushEmptyNode()->initAsChild(dicNode, pos, flags, childrenPos, childrenIndex,
+                attributesPos, siblingPos, nodeCodePoint, childrenCount, probability,
+                -1 /* bigramProbability */, isTerminal, hasMultipleChars, hasChildren,
+                additionalSubwordLength, additionalSubword);
     }
 
     DicNode *operator[](const int id) {
-        ASSERT(id < static_cast<int>(mDicNodes.size()));
+        ASSERT(id < mSize);
         return &mDicNodes[id];
     }
 
     DicNode *front() {
-        ASSERT(1 <= static_cast<int>(mDicNodes.size()));
+        ASSERT(1 <= mSize);
         return &mDicNodes[0];
     }
 
  private:
-    DISALLOW_COPY_AND_ASSIGN(DicNodeVector);
-    std::vector<DicNode> mDicNodes;
+    DISALLOW_IMPLICIT_CONSTRUCTORS(DicNodeVector);
+    static const int MIN_CAPACITY = 8;
+
+    AK_FORCE_INLINE DicNode *pushEmptyNode() {
+        if (mSize == mCapacity) {
+            reserve(mCapacity * 2);
+        }
+        return new (&mDicNodes[mSize++]) DicNode();
+    }
+
+    // Moves the nodes to a bigger array on top of the arena. The old one is only given back with
+    // the rest when the vector goes away.
+    void reserve(const int capacity) {
+        ASSERT(mDicNodes == 0 || mArena->isAtMark(mTop));
+        DicNode *const dicNodes =
+                static_cast<DicNode *>(mArena->allocate(capacity * sizeof(DicNode)));
+        for (int i = 0; i < mSize; ++i) {
+            new (&dicNodes[i]) DicNode(mDicNodes[i]);
+        }
+        mDicNodes = dicNodes;
+        mCapacity = capacity;
+        mTop = mArena->getMark();
+    }
+
+    SessionArena *const mArena;
+    const SessionArena::Mark mMark;
+    SessionArena::Mark mTop;
+    DicNode *mDicNodes;
+    int mSize;
+    int mCapacity;
     bool mLock;
-    DicNode mEmptyNode;
 };
 } // namespace latinime
 #endif // LATINIME_DIC_NODE_VECTOR_H
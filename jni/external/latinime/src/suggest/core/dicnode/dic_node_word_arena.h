@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 The Avro Keyboard Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LATINIME_DIC_NODE_WORD_ARENA_H
+#define LATINIME_DIC_NODE_WORD_ARENA_H
+
+#include <vector>
+
+#include "defines.h"
+
+namespace latinime {
+
+/**
+ * Holds the code points of the words the dic nodes of a search are spelling out. Each code point
+ * a node adds is appended once and links back to the last code point of its parent's word, so a
+ * node only keeps the index of its own last code point and shares the prefix with its parent,
+ * its siblings and every copy made of it. Nothing is ever freed by itself; the session clears
+ * the arena when it starts a search over at the root.
+ */
+class DicNodeWordArena {
+ public:
+    static const int NOT_A_LINK = -1;
+    // Past this many code points the session rather restarts the search than continues it.
+    static const int MAX_LINK_COUNT_FOR_CONTINUATION = 1 << 18;
+
+    DicNodeWordArena() : mLinks() {
+        mLinks.reserve(DEFAULT_LINK_CAPACITY);
+    }
+
+    void clear() {
+        mLinks.clear();
+    }
+
+    int size() const {
+        return static_cast<int>(mLinks.size());
+    }
+
+    // Appends the code points after |tail| and returns the link to the last of them.
+    AK_FORCE_INLINE int append(int tail, const int *const codePoints, const int length) {
+        for (int i = 0; i < length; ++i) {
+            mLinks.push_back(Link(codePoints[i], tail));
+            tail = static_cast<int>(mLinks.size()) - 1;
+        }
+        return tail;
+    }
+
+    AK_FORCE_INLINE int getCodePoint(const int link) const {
+        return mLinks[link].mCodePoint;
+    }
+
+    AK_FORCE_INLINE int getParent(const int link) const {
+        return mLinks[link].mParent;
+    }
+
+ private:
+    DISALLOW_COPY_AND_ASSIGN(DicNodeWordArena);
+    static const int DEFAULT_LINK_CAPACITY = 1 << 14;
+
+    struct Link {
+        Link(const int codePoint, const int parent) : mCodePoint(codePoint), mParent(parent) {}
+
+        int mCodePoint;
+        int mParent;
+    };
+
+    std::vector<Link> mLinks;
+};
+} // namespace latinime
+#endif // LATINIME_DIC_NODE_WORD_ARENA_H
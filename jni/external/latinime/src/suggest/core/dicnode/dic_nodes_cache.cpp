@@ -14,37 +14,35 @@
  * limitations under the License.
  */
 
-#include <list>
-
 #include "defines.h"
 #include "dic_node_priority_queue.h"
 #include "dic_node_utils.h"
 #include "dic_nodes_cache.h"
+#include "suggest/core/session/session_arena.h"
 
 namespace latinime {
 
 /**
  * Truncates all of the dicNodes so that they start at the given commit point.
- * Only called for multi-word typing input.
+ * Only called for multi-word typing input. The returned node lives in |arena|.
  */
-DicNode *DicNodesCache::setCommitPoint(int commitPoint) {
-    std::list<DicNode> dicNodesList;
-    while (mCachedDicNodesForContinuousSuggestion->getSize() > 0) {
-        DicNode dicNode;
-        mCachedDicNodesForContinuousSuggestion->copyPop(&dicNode);
-        dicNodesList.push_front(dicNode);
+DicNode *DicNodesCache::setCommitPoint(int commitPoint, SessionArena *const arena) {
+    // Best first, as the priority queue pops the worst first.
+    const int dicNodesCount = mCachedDicNodesForContinuousSuggestion->getSize();
+    DicNode *const dicNodes = arena->newArray<DicNode>(dicNodesCount);
+    for (int i = dicNodesCount - 1; i >= 0; --i) {
+        mCachedDicNodesForContinuousSuggestion->copyPop(&dicNodes[i]);
     }
 
     // Get the starting words of the top scoring dicNode (last dicNode popped from priority queue)
     // up to the commit point. These words have already been committed to the text view.
-    DicNode *topDicNode = &dicNodesList.front();
+    DicNode *topDicNode = &dicNodes[0];
     DicNode topDicNodeCopy;
     DicNodeUtils::initByCopy(topDicNode, &topDicNodeCopy);
 
     // Keep only those dicNodes that match the same starting words.
-    std::list<DicNode>::iterator iter;
-    for (iter = dicNodesList.begin(); iter != dicNodesList.end(); iter++) {
-        DicNode *dicNode = &*iter;
+    for (int i = 0; i < dicNodesCount; ++i) {
+        DicNode *dicNode = &dicNodes[i];
         if (dicNode->truncateNode(&topDicNodeCopy, commitPoint)) {
             mCachedDicNodesForContinuousSuggestion->copyPush(dicNode);
         } else {
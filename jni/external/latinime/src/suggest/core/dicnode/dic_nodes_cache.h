@@ -31,6 +31,7 @@
 namespace latinime {
 
 class DicNode;
+class SessionArena;
 
 /**
  * Class for controlling dicNode search priority queue and lexicon trie traversal.
@@ -73,7 +74,7 @@ class DicNodesCache {
                 moveNodesAndReturnReusableEmptyQueue(mNextActiveDicNodes, &mActiveDicNodes);
     }
 
-    DicNode *setCommitPoint(int commitPoint);
+    DicNode *setCommitPoint(int commitPoint, SessionArena *const arena);
 
     int activeSize() const { return mActiveDicNodes->getSize(); }
     int terminalSize() const { return mTerminalDicNodes->getSize(); }
@@ -16,6 +16,8 @@
 
 #include "suggest/core/session/dic_traverse_session.h"
 
+#include <cstring>
+
 #include "binary_format.h"
 #include "defines.h"
 #include "dictionary.h"
@@ -63,11 +65,26 @@ static TraverseSessionFactoryRegisterer traverseSessionFactoryRegisterer;
 
 void DicTraverseSession::init(const Dictionary *const dictionary, const int *prevWord,
         int prevWordLength) {
+    if (!prevWord) {
+        prevWordLength = 0;
+    }
+    if (dictionary == mDictionary && isSamePrevWord(prevWord, prevWordLength)) {
+        // Still typing after the same word: the bigrams looked up so far remain valid.
+        mPrevWordPos = mInitialPrevWordPos;
+        return;
+    }
+    // A commit or a change of context. The bigram maps are keyed by dictionary positions, so they
+    // would stay correct, but they are bounded and should go to the words of the new context.
+    mMultiBigramMap.clear();
+    mHasPrevWordBigrams = false;
     mDictionary = dictionary;
+    mFlatNodeIndex = mDictionary->getFlatNodeIndex();
     mMultiWordCostMultiplier = BinaryFormat::getMultiWordCostMultiplier(mDictionary->getDict(),
             mDictionary->getDictSize());
-    if (!prevWord) {
+    setPrevWord(prevWord, prevWordLength);
+    if (prevWordLength == 0) {
         mPrevWordPos = NOT_VALID_WORD;
+        mInitialPrevWordPos = mPrevWordPos;
         return;
     }
     // TODO: merge following similar calls to getTerminalPosition into one case-insensitive call.
@@ -79,12 +96,14 @@ void DicTraverseSession::init(const Dictionary *const dictionary, const int *pre
         mPrevWordPos = BinaryFormat::getTerminalPosition(dictionary->getOffsetDict(), prevWord,
                 prevWordLength, true /* forceLowerCaseSearch */);
     }
+    mInitialPrevWordPos = mPrevWordPos;
 }
 
 void DicTraverseSession::setupForGetSuggestions(const ProximityInfo *pInfo,
         const int *inputCodePoints, const int inputSize, const int *const inputXs,
         const int *const inputYs, const int *const times, const int *const pointerIds,
         const float maxSpatialDistance, const int maxPointerCount) {
+    mArena.reset();
     mProximityInfo = pInfo;
     mMaxPointerCount = maxPointerCount;
     initializeProximityInfoStates(inputCodePoints, inputXs, inputYs, times, pointerIds, inputSize,
@@ -101,10 +120,31 @@ int DicTraverseSession::getDictFlags() const {
 
 void DicTraverseSession::resetCache(const int nextActiveCacheSize, const int maxWords) {
     mDicNodesCache.reset(nextActiveCacheSize, maxWords);
-    mMultiBigramMap.clear();
+    mWordArena.clear();
     mPartiallyCommited = false;
 }
 
+bool DicTraverseSession::isSamePrevWord(const int *const prevWord,
+        const int prevWordLength) const {
+    if (prevWordLength != mPrevWordLength) {
+        return false;
+    }
+    return prevWordLength == 0
+            || memcmp(mPrevWord, prevWord, prevWordLength * sizeof(mPrevWord[0])) == 0;
+}
+
+void DicTraverseSession::setPrevWord(const int *const prevWord, const int prevWordLength) {
+    if (prevWordLength > MAX_WORD_LENGTH) {
+        // Never the same as the next one, so it is looked up again every time.
+        mPrevWordLength = NOT_A_PREV_WORD;
+        return;
+    }
+    if (prevWordLength > 0) {
+        memcpy(mPrevWord, prevWord, prevWordLength * sizeof(mPrevWord[0]));
+    }
+    mPrevWordLength = prevWordLength;
+}
+
 void DicTraverseSession::initializeProximityInfoStates(const int *const inputCodePoints,
         const int *const inputXs, const int *const inputYs, const int *const times,
         const int *const pointerIds, const int inputSize, const float maxSpatialDistance,
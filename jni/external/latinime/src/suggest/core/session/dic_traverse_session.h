@@ -20,24 +20,29 @@
 #include <stdint.h>
 #include <vector>
 
+#include "bigram_hash_map.h"
 #include "defines.h"
 #include "jni.h"
 #include "multi_bigram_map.h"
 #include "proximity_info_state.h"
+#include "suggest/core/dicnode/dic_node_word_arena.h"
 #include "suggest/core/dicnode/dic_nodes_cache.h"
+#include "suggest/core/session/session_arena.h"
 
 namespace latinime {
 
 class Dictionary;
+class FlatNodeIndex;
 class ProximityInfo;
 
 class DicTraverseSession {
  public:
     AK_FORCE_INLINE DicTraverseSession(JNIEnv *env, jstring localeStr)
-            : mPrevWordPos(NOT_VALID_WORD), mProximityInfo(0),
-              mDictionary(0), mDicNodesCache(), mMultiBigramMap(),
-              mInputSize(0), mPartiallyCommited(false), mMaxPointerCount(1),
-              mMultiWordCostMultiplier(1.0f) {
+            : mPrevWordPos(NOT_VALID_WORD), mPrevWord(), mPrevWordLength(NOT_A_PREV_WORD),
+              mInitialPrevWordPos(NOT_VALID_WORD), mProximityInfo(0), mDictionary(0),
+              mFlatNodeIndex(0), mDicNodesCache(), mWordArena(), mArena(), mMultiBigramMap(),
+              mPrevWordBigramMap(), mHasPrevWordBigrams(false), mInputSize(0),
+              mPartiallyCommited(false), mMaxPointerCount(1), mMultiWordCostMultiplier(1.0f) {
         // NOTE: mProximityInfoStates is an array of instances.
         // No need to initialize it explicitly here.
     }
@@ -66,8 +71,16 @@ class DicTraverseSession {
     void setPrevWordPos(int pos) { mPrevWordPos = pos; }
     // TODO: Use proper parameter when changed
     int getDicRootPos() const { return 0; }
+    const FlatNodeIndex *getFlatNodeIndex() const { return mFlatNodeIndex; }
     DicNodesCache *getDicTraverseCache() { return &mDicNodesCache; }
+    DicNodeWordArena *getWordArena() { return &mWordArena; }
+    SessionArena *getArena() { return &mArena; }
     MultiBigramMap *getMultiBigramMap() { return &mMultiBigramMap; }
+    // The bigrams of the previous word for the unigram path, which fills the map once after
+    // every change of the previous word.
+    BigramHashMap *getPrevWordBigramMap() { return &mPrevWordBigramMap; }
+    bool hasPrevWordBigrams() const { return mHasPrevWordBigrams; }
+    void setHasPrevWordBigrams() { mHasPrevWordBigrams = true; }
     const ProximityInfoState *getProximityInfoState(int id) const {
         return &mProximityInfoStates[id];
     }
@@ -136,6 +149,10 @@ class DicTraverseSession {
         if (!mDicNodesCache.hasCachedDicNodesForContinuousSuggestion()) {
             return false;
         }
+        // The words of the nodes dropped since the last restart are still in the arena.
+        if (mWordArena.size() > DicNodeWordArena::MAX_LINK_COUNT_FOR_CONTINUATION) {
+            return false;
+        }
         ASSERT(mMaxPointerCount <= MAX_POINTER_COUNT_G);
         for (int i = 0; i < mMaxPointerCount; ++i) {
             const ProximityInfoState *const pInfoState = getProximityInfoState(i);
@@ -160,17 +177,36 @@ class DicTraverseSession {
     DISALLOW_IMPLICIT_CONSTRUCTORS(DicTraverseSession);
     // threshold to start caching
     static const int CACHE_START_INPUT_LENGTH_THRESHOLD;
+    // |mPrevWordLength| before the first init, and for previous words too long to remember
+    static const int NOT_A_PREV_WORD = -1;
+
+    bool isSamePrevWord(const int *const prevWord, const int prevWordLength) const;
+    void setPrevWord(const int *const prevWord, const int prevWordLength);
     void initializeProximityInfoStates(const int *const inputCodePoints, const int *const inputXs,
             const int *const inputYs, const int *const times, const int *const pointerIds,
             const int inputSize, const float maxSpatialDistance, const int maxPointerCount);
 
     int mPrevWordPos;
+    // The previous word given to the last init, and where it was found in the dictionary. A
+    // partial commit moves |mPrevWordPos| on but leaves these alone.
+    int mPrevWord[MAX_WORD_LENGTH];
+    int mPrevWordLength;
+    int mInitialPrevWordPos;
     const ProximityInfo *mProximityInfo;
     const Dictionary *mDictionary;
+    // The dictionary's, if it has one
+    const FlatNodeIndex *mFlatNodeIndex;
 
     DicNodesCache mDicNodesCache;
-    // Temporary cache for bigram frequencies
+    // The words of every node in |mDicNodesCache|, cleared along with it
+    DicNodeWordArena mWordArena;
+    // Whatever the current getSuggestions call needs for itself, reset at its start
+    SessionArena mArena;
+    // Cache for bigram frequencies, kept for as long as the previous word stays the same
     MultiBigramMap mMultiBigramMap;
+    // Bigram probabilities of the previous word by position, for the unigram path
+    BigramHashMap mPrevWordBigramMap;
+    bool mHasPrevWordBigrams;
     ProximityInfoState mProximityInfoStates[MAX_POINTER_COUNT_G];
 
     int mInputSize;
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 The Avro Keyboard Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LATINIME_SESSION_ARENA_H
+#define LATINIME_SESSION_ARENA_H
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "defines.h"
+
+namespace latinime {
+
+/**
+ * Bump allocator for what the suggest core needs only while working out one set of suggestions.
+ * The session resets it at the start of every getSuggestions call, and the blocks it got from the
+ * heap are kept for the next call, so steady state typing does not touch the heap at all.
+ *
+ * Scoped users may also hand back everything allocated since a mark, which they must do in the
+ * reverse order of taking the marks. Destructors of the objects placed here are never run.
+ */
+class SessionArena {
+ public:
+    struct Mark {
+        int mBlockIndex;
+        size_t mUsed;
+    };
+
+    SessionArena()
+            : mBlocks(), mBlockIndex(0), mUsed(0), mAllocationCount(0),
+              mHeapAllocationCount(0) {}
+
+    // Non virtual inline destructor -- never inherit this class
+    ~SessionArena() {
+        for (size_t i = 0; i < mBlocks.size(); ++i) {
+            free(mBlocks[i].mData);
+        }
+    }
+
+    void reset() {
+        mBlockIndex = 0;
+        mUsed = 0;
+        mAllocationCount = 0;
+    }
+
+    AK_FORCE_INLINE void *allocate(const size_t size) {
+        const size_t alignedSize = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+        if (mBlockIndex >= static_cast<int>(mBlocks.size())
+                || mUsed + alignedSize > mBlocks[mBlockIndex].mSize) {
+            nextBlock(alignedSize);
+        }
+        void *const ptr = mBlocks[mBlockIndex].mData + mUsed;
+        mUsed += alignedSize;
+        ++mAllocationCount;
+        return ptr;
+    }
+
+    // Default constructs |count| objects in a row.
+    template<typename T>
+    AK_FORCE_INLINE T *newArray(const int count) {
+        T *const array = static_cast<T *>(allocate(count * sizeof(T)));
+        for (int i = 0; i < count; ++i) {
+            new (&array[i]) T();
+        }
+        return array;
+    }
+
+    Mark getMark() const {
+        Mark mark;
+        mark.mBlockIndex = mBlockIndex;
+        mark.mUsed = mUsed;
+        return mark;
+    }
+
+    bool isAtMark(const Mark &mark) const {
+        return mark.mBlockIndex == mBlockIndex && mark.mUsed == mUsed;
+    }
+
+    // Gives back everything allocated since |mark| was taken.
+    void release(const Mark &mark) {
+        mBlockIndex = mark.mBlockIndex;
+        mUsed = mark.mUsed;
+    }
+
+    // Allocations since the last reset
+    int getAllocationCount() const {
+        return mAllocationCount;
+    }
+
+    // Blocks ever taken from the heap, which should stop growing once typing warmed it up
+    int getHeapAllocationCount() const {
+        return mHeapAllocationCount;
+    }
+
+ private:
+    DISALLOW_COPY_AND_ASSIGN(SessionArena);
+    static const size_t ALIGNMENT = 8;
+    static const size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    struct Block {
+        char *mData;
+        size_t mSize;
+    };
+
+    // Moves on to a block that has room for |size|, replacing the next one should it be too small.
+    void nextBlock(const size_t size) {
+        if (mBlockIndex < static_cast<int>(mBlocks.size())) {
+            ++mBlockIndex;
+        }
+        mUsed = 0;
+        if (mBlockIndex < static_cast<int>(mBlocks.size())
+                && mBlocks[mBlockIndex].mSize >= size) {
+            return;
+        }
+        Block block;
+        block.mSize = DEFAULT_BLOCK_SIZE;
+        if (size > block.mSize) {
+            block.mSize = size;
+        }
+        block.mData = static_cast<char *>(malloc(block.mSize));
+        ++mHeapAllocationCount;
+        if (mBlockIndex < static_cast<int>(mBlocks.size())) {
+            free(mBlocks[mBlockIndex].mData);
+            mBlocks[mBlockIndex] = block;
+        } else {
+            mBlocks.push_back(block);
+        }
+    }
+
+    std::vector<Block> mBlocks;
+    int mBlockIndex;
+    size_t mUsed;
+    int mAllocationCount;
+    int mHeapAllocationCount;
+};
+} // namespace latinime
+#endif // LATINIME_SESSION_ARENA_H
@@ -72,6 +72,11 @@ int Suggest::getSuggestions(ProximityInfo *pInfo, void *traverseSession,
     PROF_START(2);
     const int size = outputSuggestions(tSession, frequencies, outWords, outputIndices, outputTypes);
     PROF_END(2);
+    if (DEBUG_SESSION_ARENA) {
+        AKLOGI("Session arena: %d allocations, %d heap allocations so far",
+                tSession->getArena()->getAllocationCount(),
+                tSession->getArena()->getHeapAllocationCount());
+    }
     PROF_CLOSE;
     return size;
 }
@@ -96,7 +101,8 @@ void Suggest::initializeSearch(DicTraverseSession *traverseSession, int commitPo
         } else {
             // Continue suggestion after partial commit.
             DicNode *topDicNode =
-                    traverseSession->getDicTraverseCache()->setCommitPoint(commitPoint);
+                    traverseSession->getDicTraverseCache()->setCommitPoint(commitPoint,
+                            traverseSession->getArena());
             traverseSession->setPrevWordPos(topDicNode->getPrevWordNodePos());
             traverseSession->getDicTraverseCache()->continueSearch();
             traverseSession->setPartiallyCommited();
@@ -107,7 +113,8 @@ void Suggest::initializeSearch(DicTraverseSession *traverseSession, int commitPo
         // Create a new dic node here
         DicNode rootNode;
         DicNodeUtils::initAsRoot(traverseSession->getDicRootPos(),
-                traverseSession->getOffsetDict(), traverseSession->getPrevWordPos(), &rootNode);
+                traverseSession->getOffsetDict(), traverseSession->getFlatNodeIndex(),
+                traverseSession->getPrevWordPos(), traverseSession->getWordArena(), &rootNode);
         traverseSession->getDicTraverseCache()->copyPushActive(&rootNode);
     }
 }
@@ -225,7 +232,8 @@ int Suggest::outputSuggestions(DicTraverseSession *traverseSession, int *frequen
  */
 void Suggest::expandCurrentDicNodes(DicTraverseSession *traverseSession) const {
     const int inputSize = traverseSession->getInputSize();
-    DicNodeVector childDicNodes(TRAVERSAL->getDefaultExpandDicNodeSize());
+    DicNodeVector childDicNodes(traverseSession->getArena(),
+            TRAVERSAL->getDefaultExpandDicNodeSize());
     DicNode correctionDicNode;
 
     // TODO: Find more efficient caching
@@ -284,8 +292,8 @@ void Suggest::expandCurrentDicNodes(DicTraverseSession *traverseSession) const {
                 createNextWordDicNode(traverseSession, &dicNode, true /* spaceSubstitution */);
             }
 
-            DicNodeUtils::getAllChildDicNodes(
-                    &dicNode, traverseSession->getOffsetDict(), &childDicNodes);
+            DicNodeUtils::getAllChildDicNodes(&dicNode, traverseSession->getOffsetDict(),
+                    traverseSession->getFlatNodeIndex(), &childDicNodes);
 
             const int childDicNodesSize = childDicNodes.getSizeAndLock();
             for (int i = 0; i < childDicNodesSize; ++i) {
@@ -431,8 +439,9 @@ void Suggest::processDicNodeAsDigraph(DicTraverseSession *traverseSession,
  */
 void Suggest::processDicNodeAsOmission(
         DicTraverseSession *traverseSession, DicNode *dicNode) const {
-    DicNodeVector childDicNodes;
-    DicNodeUtils::getAllChildDicNodes(dicNode, traverseSession->getOffsetDict(), &childDicNodes);
+    DicNodeVector childDicNodes(traverseSession->getArena());
+    DicNodeUtils::getAllChildDicNodes(dicNode, traverseSession->getOffsetDict(),
+            traverseSession->getFlatNodeIndex(), &childDicNodes);
 
     const int size = childDicNodes.getSizeAndLock();
     for (int i = 0; i < size; i++) {
@@ -456,9 +465,10 @@ void Suggest::processDicNodeAsOmission(
 void Suggest::processDicNodeAsInsertion(DicTraverseSession *traverseSession,
         DicNode *dicNode) const {
     const int16_t pointIndex = dicNode->getInputIndex(0);
-    DicNodeVector childDicNodes;
+    DicNodeVector childDicNodes(traverseSession->getArena());
     DicNodeUtils::getProximityChildDicNodes(dicNode, traverseSession->getOffsetDict(),
-            traverseSession->getProximityInfoState(0), pointIndex + 1, true, &childDicNodes);
+            traverseSession->getFlatNodeIndex(), traverseSession->getProximityInfoState(0),
+            pointIndex + 1, true, &childDicNodes);
     const int size = childDicNodes.getSizeAndLock();
     for (int i = 0; i < size; i++) {
         DicNode *const childDicNode = childDicNodes[i];
@@ -474,16 +484,18 @@ void Suggest::processDicNodeAsInsertion(DicTraverseSession *traverseSession,
 void Suggest::processDicNodeAsTransposition(DicTraverseSession *traverseSession,
         DicNode *dicNode) const {
     const int16_t pointIndex = dicNode->getInputIndex(0);
-    DicNodeVector childDicNodes1;
+    DicNodeVector childDicNodes1(traverseSession->getArena());
     DicNodeUtils::getProximityChildDicNodes(dicNode, traverseSession->getOffsetDict(),
-            traverseSession->getProximityInfoState(0), pointIndex + 1, false, &childDicNodes1);
+            traverseSession->getFlatNodeIndex(), traverseSession->getProximityInfoState(0),
+            pointIndex + 1, false, &childDicNodes1);
     const int childSize1 = childDicNodes1.getSizeAndLock();
     for (int i = 0; i < childSize1; i++) {
         if (childDicNodes1[i]->hasChildren()) {
-            DicNodeVector childDicNodes2;
+            DicNodeVector childDicNodes2(traverseSession->getArena());
             DicNodeUtils::getProximityChildDicNodes(
                     childDicNodes1[i], traverseSession->getOffsetDict(),
-                    traverseSession->getProximityInfoState(0), pointIndex, false, &childDicNodes2);
+                    traverseSession->getFlatNodeIndex(), traverseSession->getProximityInfoState(0),
+                    pointIndex, false, &childDicNodes2);
             const int childSize2 = childDicNodes2.getSizeAndLock();
             for (int j = 0; j < childSize2; j++) {
                 DicNode *const childDicNode2 = childDicNodes2[j];
@@ -523,7 +535,8 @@ void Suggest::createNextWordDicNode(DicTraverseSession *traverseSession, DicNode
     // Create a non-cached node here.
     DicNode newDicNode;
     DicNodeUtils::initAsRootWithPreviousWord(traverseSession->getDicRootPos(),
-            traverseSession->getOffsetDict(), dicNode, &newDicNode);
+            traverseSession->getOffsetDict(), traverseSession->getFlatNodeIndex(), dicNode,
+            &newDicNode);
     const CorrectionType correctionType = spaceSubstitution ?
             CT_NEW_WORD_SPACE_SUBSTITUTION : CT_NEW_WORD_SPACE_OMITTION;
     Weighting::addCostAndForwardInputIndex(WEIGHTING, correctionType, traverseSession, dicNode,
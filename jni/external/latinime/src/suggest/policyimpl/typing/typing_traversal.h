@@ -146,8 +146,10 @@ class TypingTraversal : public Traversal {
 
     AK_FORCE_INLINE bool sameAsTyped(
             const DicTraverseSession *const traverseSession, const DicNode *const dicNode) const {
+        int wordBuf[MAX_WORD_LENGTH];
+        dicNode->getOutputCodePoints(wordBuf);
         return traverseSession->getProximityInfoState(0)->sameAsTyped(
-                dicNode->getOutputWordBuf(), dicNode->getDepth());
+                wordBuf, dicNode->getDepth());
     }
 
     AK_FORCE_INLINE int getMaxCacheSize() const {
@@ -170,7 +172,7 @@ class TypingTraversal : public Traversal {
         if (probability < ScoringParams::THRESHOLD_NEXT_WORD_PROBABILITY) {
             return false;
         }
-        const int c = dicNode->getOutputWordBuf()[0];
+        const int c = dicNode->getFirstCodePoint();
         const bool shortCappedWord = dicNode->getDepth()
                 < ScoringParams::THRESHOLD_SHORT_WORD_LENGTH && isAsciiUpper(c);
         return !shortCappedWord
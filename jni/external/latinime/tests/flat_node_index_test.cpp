@@ -0,0 +1,89 @@
+// Checks FlatNodeIndex against a small trie written out by hand in the binary dictionary format.
+//
+//   flat_node_index_test
+//
+// Built for the host by jni/external/latinime/tests/Makefile, "make -C jni/external/latinime/tests
+// test" runs it.
+
+#include <cstdio>
+
+#include "flat_node_index.h"
+
+namespace latinime {
+namespace {
+
+int failures = 0;
+
+void expect(const bool condition, const char *what) {
+    if (!condition) {
+        fprintf(stderr, "FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+// The root holds "a" and "bc", and "a" has the child "d".
+//
+//   0   2 groups
+//   1   "a": terminal, children at +6, probability 100
+//   5   "bc": terminal, multiple chars, probability 50
+//   10  1 group
+//   11  "d": terminal, probability 10
+const uint8_t DICT[] = {
+    2,
+    0x50, 'a', 100, 6,
+    0x30, 'b', 'c', 0x1F, 50,
+    1,
+    0x10, 'd', 10,
+};
+
+void testEntries() {
+    FlatNodeIndex *const index = FlatNodeIndex::create(DICT, 1024);
+    if (!index) {
+        expect(false, "the index is built");
+        return;
+    }
+    expect(index->getNodeCount() == 3, "one entry per char group");
+
+    // The root's children come first, then the children of each of them in turn.
+    const int a = FlatNodeIndex::ROOT_CHILDREN_INDEX;
+    const int bc = a + 1;
+    const int d = index->getFirstChildIndex(a);
+    expect(d == 2, "the children of \"a\" follow the root's");
+    expect(index->getFirstChildIndex(bc) == NOT_AN_INDEX, "\"bc\" has no first child");
+    expect(index->getFirstChildIndex(d) == NOT_AN_INDEX, "\"d\" has no first child");
+
+    expect(index->getPosition(a) == 1 && index->getPosition(bc) == 5
+            && index->getPosition(d) == 11, "positions are those of the binary dictionary");
+    expect(index->getCodePoint(a) == 'a' && index->getCodePointCount(a) == 1,
+            "code point of \"a\"");
+    expect(index->getCodePointCount(bc) == 2 && index->getCodePoints(bc)[0] == 'b'
+            && index->getCodePoints(bc)[1] == 'c', "code points of \"bc\"");
+    expect(index->getProbability(a) == 100 && index->getProbability(bc) == 50
+            && index->getProbability(d) == 10, "probabilities");
+    expect(index->getChildrenPosition(a) == 10 + 1 && index->getChildrenCount(a) == 1,
+            "children of \"a\"");
+    expect(index->getChildrenCount(bc) == 0 && index->getChildrenCount(d) == 0,
+            "groups without children");
+    expect(index->getSiblingPosition(a) == 5, "\"bc\" follows \"a\"");
+    delete index;
+}
+
+void testMaxByteSize() {
+    FlatNodeIndex *const index = FlatNodeIndex::create(DICT, 10);
+    expect(!index, "no index larger than the given size");
+    delete index;
+}
+
+} // namespace
+} // namespace latinime
+
+int main() {
+    latinime::testEntries();
+    latinime::testMaxByteSize();
+    if (latinime::failures) {
+        fprintf(stderr, "%d failures\n", latinime::failures);
+        return 1;
+    }
+    printf("flat_node_index_test: OK\n");
+    return 0;
+}
@@ -1,9 +1,17 @@
 #!/bin/bash
+# Usage: ./mksnapshot.sh [avro]
+#
+# With "avro", mksnapshot also evaluates avro.min.js and avro.init.js and bakes the resulting
+# heap into the snapshot, so every new context comes up with Avro already initialised.
 cd jni/external/v8
 rm -rf host
 mkdir -p host
 cd host
 scons -Y.. simulator=arm snapshot=on
+if [ "$1" == "avro" ]; then
+	{ cat ../../../../assets/avro.min.js; echo ";"; cat ../../../../assets/avro.init.js; } > avro.snapshot.js
+	obj/release/mksnapshot --extra_code=avro.snapshot.js obj/release/snapshot.cc || exit 1
+fi
 mv obj/release/snapshot.cc ../../../snapshot.cc
 cd ../../..
-echo Copied snapshot to `pwd`/snapshot.cc
\ No newline at end of file
+echo Copied snapshot to `pwd`/snapshot.cc
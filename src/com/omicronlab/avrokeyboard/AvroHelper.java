@@ -5,22 +5,40 @@ import java.io.FileOutputStream;
 import java.io.IOException;
 import java.io.InputStream;
 import android.content.Context;
+import android.content.SharedPreferences;
+import android.content.pm.PackageManager;
+import android.content.res.AssetFileDescriptor;
+import android.util.Log;
 
 public class AvroHelper {
+	// Remembers the versionCode of the apk each copy in the files dir was made from.
+	private static final String COPIES_PREFS = "asset_copies";
+
 	public static boolean isFirstLaunch(PhoneticIM Caller, String filename){
-		//TODO: Need to check if this is first launch, so should i copy the asset or not.
-		//Now i'm just checking if the js file copied, but actually need to check timestamp or something.
-		//Bcz if a older version of file exists, i need to detect that using timestamp and copy newer file.
-		
+		// First launch of this version of the apk: an update must replace the copies made from
+		// the assets of the older one.
 		String filepath = Caller.getFilesDir().getAbsolutePath() + "/" + filename;
-		return !(new File(filepath).exists());
+		SharedPreferences copies = Caller.getSharedPreferences(COPIES_PREFS, Context.MODE_PRIVATE);
+		return !(new File(filepath).exists()) || copies.getInt(filename, -1) != getVersionCode(Caller);
 	}
 
-	public static boolean copyJavascriptLib(PhoneticIM Caller, String fileName){
+	private static int getVersionCode(PhoneticIM Caller){
+		try {
+			return Caller.getPackageManager().getPackageInfo(Caller.getPackageName(), 0).versionCode;
+		}
+		catch (PackageManager.NameNotFoundException e)
+		{
+			return 0;
+		}
+	}
 
+	public static boolean copyJavascriptLib(PhoneticIM Caller, String fileName){
+		// Written under a temporary name and renamed into place, so a copy cut short never
+		// passes for a complete one.
+		String tempName = fileName + ".tmp";
 		try {
 			InputStream localInputStream = Caller.getAssets().open(fileName);
-	        FileOutputStream localFileOutputStream = Caller.getBaseContext().openFileOutput(fileName, Context.MODE_PRIVATE);
+	        FileOutputStream localFileOutputStream = Caller.getBaseContext().openFileOutput(tempName, Context.MODE_PRIVATE);
 	
 	        byte[] arrayOfByte = new byte[1024];
 	        int offset;
@@ -28,15 +46,47 @@ public class AvroHelper {
 	        {
 	          localFileOutputStream.write(arrayOfByte, 0, offset);
 	        }
+	        localFileOutputStream.getFD().sync();
 	        localFileOutputStream.close();
 	        localInputStream.close();
-	        return true;
 		}
 		catch (IOException localIOException)
         {
             localIOException.printStackTrace();
+            Caller.deleteFile(tempName);
             return false;
         }
+
+		File tempFile = Caller.getFileStreamPath(tempName);
+		if (!tempFile.renameTo(Caller.getFileStreamPath(fileName))){
+			Caller.deleteFile(tempName);
+			return false;
+		}
+		Caller.getSharedPreferences(COPIES_PREFS, Context.MODE_PRIVATE).edit()
+				.putInt(fileName, getVersionCode(Caller)).commit();
+		return true;
+	}
+
+	public static boolean loadDictionary(PhoneticIM Caller, String fileName){
+		// The dictionary is mapped in place from the apk. Its .mp3 extension keeps aapt from
+		// compressing it, and if it got compressed anyway openFd throws and it is copied to the
+		// files dir instead.
+		try {
+			AssetFileDescriptor afd = Caller.getAssets().openFd(fileName);
+			boolean loaded = Caller.loaddict(Caller.getApplicationInfo().sourceDir, afd.getStartOffset(), afd.getLength());
+			afd.close();
+			return loaded;
+		}
+		catch (IOException localIOException)
+		{
+			Log.v("Avro","Dictionary is compressed in the apk, loading a copy");
+		}
+
+		if (isFirstLaunch(Caller, fileName) && !copyJavascriptLib(Caller, fileName)){
+			return false;
+		}
+		File file = new File(Caller.getFilesDir().getAbsolutePath() + "/" + fileName);
+		return Caller.loaddict(file.getAbsolutePath(), 0, file.length());
 	}
 
 }
@@ -22,7 +22,7 @@ public class CandidateView extends View {
     private int mSelectedIndex;
     private int mTouchX = OUT_OF_BOUNDS;
     private Drawable mSelectionHighlight;
-    private boolean mTypedWordValid;
+    private int mRecommendedIndex;
     
     private Rect mBgPadding;
 
@@ -159,7 +159,7 @@ public class CandidateView extends View {
         final int touchX = mTouchX;
         final int scrollX = getScrollX();
         final boolean scrolled = mScrolled;
-        final boolean typedWordValid = mTypedWordValid;
+        final int recommendedIndex = mRecommendedIndex;
         final int y = (int) (((height - mPaint.getTextSize()) / 2) - mPaint.ascent());
 
         for (int i = 0; i < count; i++) {
@@ -181,7 +181,7 @@ public class CandidateView extends View {
             }
 
             if (canvas != null) {
-                if ((i == 1 && !typedWordValid) || (i == 0 && typedWordValid)) {
+                if (i == recommendedIndex) {
                     paint.setFakeBoldText(true);
                     paint.setColor(mColorRecommended);
                 } else if (i != 0) {
@@ -222,11 +222,19 @@ public class CandidateView extends View {
     
     public void setSuggestions(List<String> suggestions, boolean completions,
             boolean typedWordValid) {
+        setSuggestions(suggestions, typedWordValid ? 0 : 1);
+    }
+
+    /**
+     * Shows the suggestions with the one at recommendedIndex highlighted, such as the
+     * candidate the user picked the last time they typed the same thing.
+     */
+    public void setSuggestions(List<String> suggestions, int recommendedIndex) {
         clear();
         if (suggestions != null) {
             mSuggestions = new ArrayList<String>(suggestions);
         }
-        mTypedWordValid = typedWordValid;
+        mRecommendedIndex = recommendedIndex;
         scrollTo(0, 0);
         mTargetScrollX = 0;
         // Compute the total width
@@ -1,19 +1,20 @@
 package com.omicronlab.avrokeyboard;
 
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.List;
 import java.util.logging.Logger;
 
-import org.json.JSONArray;
-import org.json.JSONException;
-import org.json.JSONObject;
-
 import android.content.Context;
+import android.content.pm.ApplicationInfo;
 import android.inputmethodservice.InputMethodService;
 import android.inputmethodservice.Keyboard;
 import android.inputmethodservice.Keyboard.*;
 import android.inputmethodservice.KeyboardView;
 import android.inputmethodservice.KeyboardView.OnKeyboardActionListener;
+import android.os.Handler;
+import android.os.Looper;
+import android.os.MessageQueue;
 import android.util.Log;
 import android.view.LayoutInflater;
 import android.view.View;
@@ -24,34 +25,97 @@ import android.widget.LinearLayout.LayoutParams;
 public class PhoneticIM extends InputMethodService implements OnKeyboardActionListener {
 	String ctext = "";
 	CandidateView mCandidateView;
+	// Suggestions are built on a native worker thread and handed back here.
+	Handler mHandler;
+	boolean mSuggestAsync = false;
+	// Bumped for every keystroke, results for an older one are thrown away.
+	int mSuggestionSequence = 0;
+	// What the candidate view shows, and the candidate picked the last time the same was typed.
+	List<String> mSuggestions = new ArrayList<String>();
+	int mSelection = 0;
+	// Debug builds record where the time of each keystroke goes, see dumptrace().
+	boolean mTracing = false;
+	// Whether avro.min.js has been loaded into V8, see loadJsIfNeeded().
+	boolean mJsLoaded = false;
+	// Lets V8 collect garbage once the UI thread runs out of work after a word is committed.
+	final MessageQueue.IdleHandler mJsIdleHandler = new MessageQueue.IdleHandler() {
+		public boolean queueIdle() {
+			jsidle(false);
+			return false;
+		}
+	};
 	@Override
 	public void onCreate() {
         super.onCreate();
+        mHandler = new Handler();
         Log.v("Avro","Avro started");
         
-        String filename1 = "avro.min.js" ;
-        String filename2 = "avro.init.js" ;
-        
-        if (AvroHelper.isFirstLaunch(this, filename1)){
-        	boolean success = AvroHelper.copyJavascriptLib(this,filename1) && AvroHelper.copyJavascriptLib(this,filename2);
-        	Log.v("Avro","Coping JS File " + (success ? "Sucessful" : "Failed") );
-        	
-        } else {
-        	Log.v("Avro","JS File Already Copied, Not copying again");
-        }
-        // TODO: Need to crash the app now if js file copy failed
+        mTracing = (getApplicationInfo().flags & ApplicationInfo.FLAG_DEBUGGABLE) != 0;
+        settrace(mTracing);
         
-        // Load the js file inside v8
         setdir(getFilesDir().getAbsolutePath() + "/");
+        
         long startTime = System.nanoTime();
-        loadjs(filename1, filename2);
+        boolean dictLoaded = AvroHelper.loadDictionary(this, "avrodict.dict.mp3");
         long endTime = System.nanoTime();
-
+        
         double duration = (endTime - startTime) / 1000000000.0;
-        Log.v("Avro","Js Load Time: " + duration);
+        Log.v("Avro","Dictionary " + (dictLoaded ? "Loaded" : "Load Failed") + ", Load Time: " + duration);
+        
+        // Everything is done natively with the dictionary, the js is only the fallback without it.
+        if (!dictLoaded) {
+        	loadJsIfNeeded();
+        }
         
+        if (dictLoaded && !opensel(getFilesDir().getAbsolutePath() + "/selections")) {
+        	Log.v("Avro","Can't open the candidate selections, they won't be remembered");
+        }
+        mSuggestAsync = dictLoaded && startsuggest();
+        Log.v("Avro","Suggestions are built " + (mSuggestAsync ? "in the background" : "on the UI thread"));
     }
 	
+	// Copies the js files out of the apk when it was installed or updated, and loads them into V8,
+	// which parses 3.8 MB of script and builds all the dictionary tables. Only done once something
+	// needs the js.
+	void loadJsIfNeeded() {
+		if (mJsLoaded) return;
+		
+		String filename1 = "avro.min.js" ;
+		String filename2 = "avro.init.js" ;
+		
+		boolean success = true;
+		if (AvroHelper.isFirstLaunch(this, filename1)){
+			success = AvroHelper.copyJavascriptLib(this,filename1);
+		}
+		if (success && AvroHelper.isFirstLaunch(this, filename2)){
+			success = AvroHelper.copyJavascriptLib(this,filename2);
+		}
+		Log.v("Avro","JS Files " + (success ? "Up To Date" : "Copy Failed") );
+		// TODO: Need to crash the app now if js file copy failed
+		
+		// Load the js file inside v8
+		long startTime = System.nanoTime();
+		loadjs(filename1, filename2);
+		long endTime = System.nanoTime();
+		mJsLoaded = true;
+		
+		double duration = (endTime - startTime) / 1000000000.0;
+		Log.v("Avro","Js Load Time: " + duration);
+	}
+	
+	@Override
+	public void onDestroy() {
+		Log.v("Avro","Suggestion caches: " + avrocachestats());
+		if (mSuggestAsync) {
+			stopsuggest();
+			mSuggestAsync = false;
+		}
+		if (mTracing) {
+			dumptrace(getFilesDir().getAbsolutePath() + "/avro-trace.json");
+		}
+		super.onDestroy();
+	}
+	
 	@Override 
 	public View onCreateInputView() {
 		KeyboardView kbdview = (KeyboardView) getLayoutInflater().inflate(
@@ -79,6 +143,23 @@ public class PhoneticIM extends InputMethodService implements OnKeyboardActionLi
 	@Override 
 	public void onFinishInput() {
         super.onFinishInput();
+        jsidle(true);
+	}
+	
+	// Only called from API 14 on, hence no @Override against the android-10 target.
+	public void onTrimMemory(int level) {
+		// ComponentCallbacks2.TRIM_MEMORY_RUNNING_LOW and worse.
+		if (level >= 10) {
+			jslowmemory();
+			trimdict();
+		}
+	}
+	
+	@Override
+	public void onLowMemory() {
+		super.onLowMemory();
+		jslowmemory();
+		trimdict();
 	}
 
 	@Override
@@ -107,6 +188,8 @@ public class PhoneticIM extends InputMethodService implements OnKeyboardActionLi
 		if(arg0 == 32) {
 			ic.commitText(ctext, 1);
 			ctext = "";
+			mSuggestionSequence++;
+			scheduleJsIdle();
 			return;
 		}
 		
@@ -114,12 +197,51 @@ public class PhoneticIM extends InputMethodService implements OnKeyboardActionLi
 		ic.setComposingText(ctext, 1);
 		//setCandidatesView(mCandidateView);
 		
+		if (mSuggestAsync) {
+			postsuggest(++mSuggestionSequence, ctext);
+			return;
+		}
+		
 		List<String> suggestions = SuggestionBuilder(ctext);
 		
 		
-		mCandidateView.setSuggestions(suggestions , true, true);
+		showSuggestions(suggestions, avroselection());
+	}
+	
+	void showSuggestions(List<String> suggestions, int selection) {
+		mSuggestions = suggestions;
+		mSelection = selection;
+		mCandidateView.setSuggestions(suggestions, selection);
 		setCandidatesViewShown(true);
 	}
+	
+	// Called from the native suggestion worker thread.
+	public void onSuggestions(final int sequence, final String[] words, final int selection) {
+		mHandler.post(new Runnable() {
+			public void run() {
+				if (sequence != mSuggestionSequence || mCandidateView == null) return;
+				showSuggestions(Arrays.asList(words), selection);
+			}
+		});
+	}
+	
+	// Commits the candidate at index, and remembers it was picked for what was typed.
+	public void pickSuggestionManually(int index) {
+		if (index < 0 || index >= mSuggestions.size()) return;
+		String word = mSuggestions.get(index);
+		selectsuggest(ctext, word);
+		getCurrentInputConnection().commitText(word, 1);
+		ctext = "";
+		mSuggestionSequence++;
+		showSuggestions(new ArrayList<String>(), 0);
+		scheduleJsIdle();
+	}
+	
+	void scheduleJsIdle() {
+		MessageQueue queue = Looper.myQueue();
+		queue.removeIdleHandler(mJsIdleHandler);
+		queue.addIdleHandler(mJsIdleHandler);
+	}
 
 	@Override
 	public void onRelease(int arg0) {
@@ -158,22 +280,7 @@ public class PhoneticIM extends InputMethodService implements OnKeyboardActionLi
 	}
 	
 	List<String> SuggestionBuilder(String entext) {
-		List<String> list = new ArrayList<String>();
-		
-		String bntext = avroparse(entext);
-		try {
-			
-			JSONArray words = new JSONArray(bntext);
-			
-			for (int index = 0 ; index < words.length() ; ++index){
-				list.add(words.get(index).toString());
-			}
-			
-		} catch (JSONException e) {
-			// TODO Auto-generated catch block
-			e.printStackTrace();
-		}
-		return list;
+		return Arrays.asList(avrosuggest(entext));
 	}
 
 	
@@ -182,6 +289,22 @@ public class PhoneticIM extends InputMethodService implements OnKeyboardActionLi
 	public native void  loadjs(String sk1, String sk2);
 	public native void  killjs();
 	public native String avroparse(String sk1); 
+	public native boolean loaddict(String sourceDir, long offset, long length);
+	public native String[] avrosearch(String sk1);
+	public native String[] avrosuggest(String sk1);
+	public native boolean startsuggest();
+	public native void stopsuggest();
+	public native void postsuggest(int sequence, String sk1);
+	public native int avroselection();
+	public native boolean opensel(String path);
+	public native void selectsuggest(String sk1, String word);
+	public native String avrocachestats();
+	public native void settrace(boolean enabled);
+	public native String avrotrace();
+	public native boolean dumptrace(String path);
+	public native void jsidle(boolean finished);
+	public native void jslowmemory();
+	public native void trimdict();
 	static {
 		System.loadLibrary("stlport_shared");
         System.loadLibrary("avrov8");